@@ -0,0 +1,207 @@
+#include "asset_archive.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const char ARCHIVE_MAGIC[4] = { 'S', 'P', 'D', 'A' };
+static const uint32_t ARCHIVE_VERSION = 1;
+static const size_t ARCHIVE_HEADER_SIZE = 16;
+static const size_t ARCHIVE_NAME_SIZE = 48;
+static const size_t ARCHIVE_ENTRY_SIZE = ARCHIVE_NAME_SIZE + 16;
+static const size_t ARCHIVE_ALIGNMENT = 16;
+
+static void putU32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; i++) out.push_back((uint8_t)(value >> (i * 8)));
+}
+
+static void putU64(std::vector<uint8_t>& out, uint64_t value) {
+    for (int i = 0; i < 8; i++) out.push_back((uint8_t)(value >> (i * 8)));
+}
+
+static uint64_t readFixed(const uint8_t* data, int bytes) {
+    uint64_t value = 0;
+    for (int i = 0; i < bytes; i++) value |= (uint64_t)data[i] << (i * 8);
+    return value;
+}
+
+AssetArchive::~AssetArchive() {
+    close();
+}
+
+bool AssetArchive::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    HANDLE mapping = NULL;
+    const void* view = nullptr;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping) {
+            view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        }
+    }
+    if (!view) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    mapped = (const uint8_t*)view;
+    mappedSize = (size_t)fileSize.QuadPart;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    void* view = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // Eşleme dosya tanıtıcısından bağımsız yaşar => // The mapping outlives the file descriptor
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    mapped = (const uint8_t*)view;
+    mappedSize = (size_t)info.st_size;
+#endif
+
+    // Başlık ve indeksi doğrula; bozuk arşiv hiç açılmamış sayılır
+    // Validate the header and index; a corrupt archive counts as not opened
+    bool valid = mappedSize >= ARCHIVE_HEADER_SIZE && std::memcmp(mapped, ARCHIVE_MAGIC, 4) == 0 &&
+                 readFixed(mapped + 4, 4) == ARCHIVE_VERSION;
+    uint64_t count = valid ? readFixed(mapped + 8, 4) : 0;
+    if (valid && ARCHIVE_HEADER_SIZE + count * ARCHIVE_ENTRY_SIZE > mappedSize) {
+        valid = false;
+    }
+    for (uint64_t i = 0; valid && i < count; i++) {
+        const uint8_t* record = mapped + ARCHIVE_HEADER_SIZE + i * ARCHIVE_ENTRY_SIZE;
+        Entry entry;
+        entry.name.assign((const char*)record, strnlen((const char*)record, ARCHIVE_NAME_SIZE));
+        entry.offset = readFixed(record + ARCHIVE_NAME_SIZE, 8);
+        entry.size = readFixed(record + ARCHIVE_NAME_SIZE + 8, 8);
+        if (entry.offset > mappedSize || entry.size > mappedSize - entry.offset) {
+            valid = false;
+            break;
+        }
+        entries.push_back(std::move(entry));
+    }
+
+    if (!valid) {
+        std::cerr << "Invalid asset archive: " << path << std::endl;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void AssetArchive::close() {
+    if (mapped) {
+#ifdef _WIN32
+        UnmapViewOfFile(mapped);
+        CloseHandle((HANDLE)mappingHandle);
+        CloseHandle((HANDLE)fileHandle);
+        mappingHandle = nullptr;
+        fileHandle = nullptr;
+#else
+        munmap((void*)mapped, mappedSize);
+#endif
+    }
+    mapped = nullptr;
+    mappedSize = 0;
+    entries.clear();
+}
+
+AssetView AssetArchive::find(const std::string& name) const {
+    // Birkaç girdi var; doğrusal arama yeterli => // Only a handful of entries; a linear search is enough
+    for (const Entry& entry : entries) {
+        if (entry.name == name) {
+            AssetView view;
+            view.data = mapped + entry.offset;
+            view.size = (size_t)entry.size;
+            return view;
+        }
+    }
+    return AssetView();
+}
+
+bool AssetArchive::pack(const std::vector<std::string>& files, const std::string& outPath) {
+    std::vector<std::vector<uint8_t>> contents;
+    contents.reserve(files.size());
+    for (const std::string& path : files) {
+        std::string name = std::filesystem::path(path).filename().string();
+        if (name.size() >= ARCHIVE_NAME_SIZE) {
+            std::cerr << "Asset name too long (max " << ARCHIVE_NAME_SIZE - 1 << "): " << name << std::endl;
+            return false;
+        }
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            std::cerr << "Cannot read asset: " << path << std::endl;
+            return false;
+        }
+        contents.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    std::vector<uint8_t> out;
+    out.insert(out.end(), ARCHIVE_MAGIC, ARCHIVE_MAGIC + 4);
+    putU32(out, ARCHIVE_VERSION);
+    putU32(out, (uint32_t)files.size());
+    putU32(out, 0);
+
+    // Veri indeksin hemen ardından, her girdi hizalı başlar => // Data follows the index, every entry starts aligned
+    uint64_t offset = ARCHIVE_HEADER_SIZE + files.size() * ARCHIVE_ENTRY_SIZE;
+    std::vector<uint64_t> offsets;
+    for (size_t i = 0; i < files.size(); i++) {
+        offset = (offset + ARCHIVE_ALIGNMENT - 1) / ARCHIVE_ALIGNMENT * ARCHIVE_ALIGNMENT;
+        offsets.push_back(offset);
+
+        char name[ARCHIVE_NAME_SIZE] = {};
+        std::string fileName = std::filesystem::path(files[i]).filename().string();
+        std::memcpy(name, fileName.data(), fileName.size());
+        out.insert(out.end(), name, name + ARCHIVE_NAME_SIZE);
+        putU64(out, offset);
+        putU64(out, contents[i].size());
+        offset += contents[i].size();
+    }
+
+    for (size_t i = 0; i < files.size(); i++) {
+        out.resize(offsets[i], 0);
+        out.insert(out.end(), contents[i].begin(), contents[i].end());
+    }
+
+    std::ofstream file(outPath, std::ios::binary);
+    file.write((const char*)out.data(), (std::streamsize)out.size());
+    return (bool)file;
+}
+
+bool AssetArchive::findArchive(const char* fileName, std::string& out) {
+    for (const char* directory : { ".", "..", "../.." }) {
+        std::filesystem::path candidate = std::filesystem::path(directory) / fileName;
+        if (std::filesystem::exists(candidate)) {
+            out = candidate.string();
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+// Paketlenmiş varlık arşivi: tüm sesler tek bir indeksli dosyada.
+// Packed asset archive: every sound in one indexed file.
+//
+// Çalışma zamanında dosya bir kez açılır ve belleğe eşlenir (mmap); girdiler
+// eşlenmiş baytlara doğrudan işaret eder, kopyalanmaz. Sayfalar ilk okunduğunda
+// yüklenir ve aynı makinedeki tüm oyun örnekleri sayfa önbelleğini paylaşır.
+// At run time the file is opened once and memory-mapped; entries point straight
+// into the mapped bytes, nothing is copied. Pages load on first touch and every
+// game instance on the same host shares the page cache.
+//
+// Dosya biçimi (little-endian) => // File format (little-endian):
+//   "SPDA" | u32 sürüm | u32 girdi sayısı | u32 ayrılmış
+//   her girdi: char ad[48] (NUL dolgulu) | u64 konum | u64 boyut
+//   veri; her girdi 16 bayta hizalı => // data; every entry aligned to 16 bytes
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// Eşlenmiş bir girdinin baytları; data == nullptr ise girdi yok
+// Bytes of a mapped entry; data == nullptr if the entry is missing
+struct AssetView {
+    const void* data = nullptr;
+    size_t size = 0;
+
+    explicit operator bool() const { return data != nullptr; }
+};
+
+class AssetArchive {
+public:
+    AssetArchive() = default;
+    ~AssetArchive();
+
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    // Dosyayı eşle ve indeksi doğrula => // Map the file and validate the index
+    bool open(const std::string& path);
+    // Eşlemeyi kaldır; önceki AssetView'lar geçersiz olur => // Unmap; earlier AssetViews become invalid
+    void close();
+    bool isOpen() const { return mapped != nullptr; }
+
+    AssetView find(const std::string& name) const;
+    size_t entryCount() const { return entries.size(); }
+    const std::string& entryName(size_t index) const { return entries[index].name; }
+
+    // Dosyaları (ad = dosya adı) bir arşive yaz; paketleme aracı kullanır
+    // Write files into an archive (name = file name); used by the pack tool
+    static bool pack(const std::vector<std::string>& files, const std::string& outPath);
+
+    // Arşivi sounds dizinleriyle aynı yerlerde ara => // Look for the archive in the same places as the sounds directory
+    static bool findArchive(const char* fileName, std::string& out);
+
+private:
+    struct Entry {
+        std::string name;
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    const uint8_t* mapped = nullptr;
+    size_t mappedSize = 0;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+    std::vector<Entry> entries;
+};
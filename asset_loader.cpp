@@ -0,0 +1,166 @@
+#include "asset_loader.h"
+#include <algorithm>
+#include <iostream>
+#include <cmath>
+
+ThreadPool::ThreadPool(unsigned threadCount) {
+    threadCount = std::max(1u, threadCount);
+    workers.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; i++) {
+        workers.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeup.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::workerLoop() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeup.wait(lock, [this]() { return stopping || !tasks.empty(); });
+            if (tasks.empty()) {
+                return; // stopping ve kuyruk boş => // stopping and the queue is drained
+            }
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        task();
+    }
+}
+
+bool SoundClip::waitReady() {
+    if (state == 0) {
+        if (!ready.valid()) {
+            return false;
+        }
+        state = ready.get() ? 1 : -1;
+        if (state < 0) {
+            std::cerr << "Sound failed to load: " << path << std::endl;
+        }
+    }
+    return state > 0;
+}
+
+bool SoundClip::isReady() const {
+    return state != 0 || (ready.valid() && ready.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+}
+
+size_t SoundClip::sampleBytes() const {
+    return (size_t)samples.getSampleCount() * sizeof(int16_t);
+}
+
+bool compactSoundBuffer(const sf::SoundBuffer& source, sf::SoundBuffer& out, unsigned maxSampleRate) {
+    const auto* input = source.getSamples();
+    const size_t channels = std::max(1u, source.getChannelCount());
+    const size_t frames = (size_t)source.getSampleCount() / channels;
+    const unsigned sourceRate = source.getSampleRate();
+    if (frames == 0 || sourceRate == 0) {
+        return false;
+    }
+
+    // Kanalların ortalaması => // Average of the channels
+    std::vector<int16_t> mono(frames);
+    for (size_t i = 0; i < frames; i++) {
+        int sum = 0;
+        for (size_t c = 0; c < channels; c++) {
+            sum += input[i * channels + c];
+        }
+        mono[i] = (int16_t)(sum / (int)channels);
+    }
+
+    // Doğrusal aradeğerleme ile alt örnekle (efektler için yeterli) => // Downsample with linear interpolation (good enough for effects)
+    unsigned rate = sourceRate;
+    if (maxSampleRate > 0 && sourceRate > maxSampleRate) {
+        rate = maxSampleRate;
+        const double step = (double)sourceRate / (double)rate;
+        const size_t outFrames = std::max<size_t>(1, (size_t)((double)frames / step));
+        std::vector<int16_t> resampled(outFrames);
+        for (size_t i = 0; i < outFrames; i++) {
+            double position = (double)i * step;
+            size_t index = std::min((size_t)position, frames - 1);
+            size_t nextIndex = std::min(index + 1, frames - 1);
+            double t = position - (double)index;
+            resampled[i] = (int16_t)std::lround(mono[index] * (1.0 - t) + mono[nextIndex] * t);
+        }
+        mono.swap(resampled);
+    }
+
+    // SFML 3 kanal haritası ister => // SFML 3 wants a channel map
+#if SFML_VERSION_MAJOR >= 3
+    return out.loadFromSamples(mono.data(), mono.size(), 1, rate, { sf::SoundChannel::Mono });
+#else
+    return out.loadFromSamples(mono.data(), mono.size(), 1, rate);
+#endif
+}
+
+static unsigned defaultLoaderThreads() {
+    unsigned hardware = std::thread::hardware_concurrency();
+    return std::max(2u, std::min(4u, hardware));
+}
+
+AssetLoader::AssetLoader() : pool(defaultLoaderThreads()) {}
+
+AssetLoader::AssetLoader(unsigned threadCount) : pool(threadCount) {}
+
+bool AssetLoader::findSoundDirectory(std::filesystem::path& out) {
+    for (const char* candidate : { "sounds", "../sounds", "../../sounds" }) {
+        if (std::filesystem::exists(candidate)) {
+            out = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+void AssetLoader::load(SoundClip& clip, const std::filesystem::path& path) {
+    clip.path = path.string();
+    clip.state = 0;
+    SoundClip* target = &clip;
+    unsigned rate = compactSampleRate;
+    clip.ready = pool.submit([target, rate]() {
+        if (rate == 0) {
+            return target->samples.loadFromFile(target->path);
+        }
+        sf::SoundBuffer decoded;
+        return decoded.loadFromFile(target->path) && compactSoundBuffer(decoded, target->samples, rate);
+    }).share();
+}
+
+std::shared_future<bool> AssetLoader::open(sf::Music& music, const std::filesystem::path& path) {
+    sf::Music* target = &music;
+    std::string file = path.string();
+    return pool.submit([target, file]() {
+        return target->openFromFile(file);
+    }).share();
+}
+
+void AssetLoader::load(SoundClip& clip, const void* data, size_t size, const std::string& name) {
+    clip.path = name;
+    clip.state = 0;
+    SoundClip* target = &clip;
+    unsigned rate = compactSampleRate;
+    clip.ready = pool.submit([target, data, size, rate]() {
+        if (rate == 0) {
+            return target->samples.loadFromMemory(data, size);
+        }
+        sf::SoundBuffer decoded;
+        return decoded.loadFromMemory(data, size) && compactSoundBuffer(decoded, target->samples, rate);
+    }).share();
+}
+
+std::shared_future<bool> AssetLoader::open(sf::Music& music, const void* data, size_t size) {
+    sf::Music* target = &music;
+    return pool.submit([target, data, size]() {
+        return target->openFromMemory(data, size);
+    }).share();
+}
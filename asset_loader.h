@@ -0,0 +1,122 @@
+#pragma once
+
+// Başlangıçta varlıkları arka planda yükleyen küçük iş parçacığı havuzu.
+// Background asset loading at startup on a small thread pool.
+//
+// Ses dosyaları pencere ve GL bağlamı açılırken paralel çözülür. Her yükleme
+// bir future döner; oyun yalnızca o varlığı ilk kullandığında bekler, böylece
+// ilk kareye kadar geçen süre pencere oluşturma maliyetine iner.
+// Sound files are decoded in parallel while the window and GL context come up.
+// Every load returns a future; the game only waits when it first uses that
+// asset, so time-to-first-frame drops to the cost of window creation.
+//
+// Yüklenen arabelleğe hiçbir sf::Sound bağlı değildir (SFML yükleme sırasında
+// bağlı sesleri günceller, bu da başka iş parçacığından yarış olurdu); sesler
+// bir SoundClip'e ancak waitReady() sonrası ana iş parçacığında bağlanır.
+// No sf::Sound is attached to a buffer while it loads (SFML updates attached
+// sounds during a load, which would race with the main thread); voices are only
+// bound to a SoundClip on the main thread after waitReady().
+
+#include <SFML/Audio.hpp>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned threadCount);
+    // Kuyruktaki tüm işleri bitirir, sonra iş parçacıklarını kapatır => // Finishes every queued task, then joins the threads
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // İşi kuyruğa ekle; sonucu future ile alınır => // Queue a task; its result comes back through a future
+    template <typename Task>
+    auto submit(Task&& task) -> std::future<decltype(task())> {
+        using Result = decltype(task());
+        // std::function kopyalanabilir ister, packaged_task değildir => // std::function needs a copyable callable, packaged_task is not
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(task));
+        std::future<Result> result = packaged->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push([packaged]() { (*packaged)(); });
+        }
+        wakeup.notify_one();
+        return result;
+    }
+
+private:
+    void workerLoop();
+
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    bool stopping = false;
+};
+
+// Arka planda çözülen efekt sesi; sıkıştırılmış (mono 16-bit) örnekleri tutar, çalmayı VoicePool yapar
+// An effect sound decoded in the background; holds compact (mono 16-bit) samples, VoicePool plays it
+class SoundClip {
+public:
+    // Yükleme bitmediyse bekler; başarısızsa false döner (hata bir kez yazılır)
+    // Waits if the load has not finished yet; returns false if it failed (the error is logged once)
+    bool waitReady();
+    // Yükleme bitti mi (beklemeden) => // Has the load finished (without waiting)
+    bool isReady() const;
+
+    // Yalnızca waitReady() true döndükten sonra kullan => // Only use after waitReady() returned true
+    const sf::SoundBuffer& buffer() const { return samples; }
+    // Örneklerin bellekteki boyutu => // Size of the samples in memory
+    size_t sampleBytes() const;
+
+private:
+    friend class AssetLoader;
+
+    std::string path;
+    sf::SoundBuffer samples;
+    std::shared_future<bool> ready;
+    int state = 0; // 0 = bekleniyor, 1 = hazır, -1 = başarısız
+};
+
+// Çözülmüş sesi mono 16-bit'e indir ve en fazla maxSampleRate'e yeniden örnekle
+// Downmix a decoded sound to mono 16-bit and resample it to at most maxSampleRate
+bool compactSoundBuffer(const sf::SoundBuffer& source, sf::SoundBuffer& out, unsigned maxSampleRate);
+
+class AssetLoader {
+public:
+    // Varsayılan: donanım iş parçacığı sayısına göre 2-4 işçi => // Default: 2-4 workers depending on hardware threads
+    AssetLoader();
+    explicit AssetLoader(unsigned threadCount);
+
+    // sounds, ../sounds, ../../sounds dizinlerini sırayla dene => // Try sounds, ../sounds, ../../sounds in order
+    static bool findSoundDirectory(std::filesystem::path& out);
+
+    // Efekt seslerinin saklandığı en yüksek örnekleme hızı; 0 = dosyadaki gibi bırak
+    // Highest sample rate effect sounds are stored at; 0 = keep the file's format
+    unsigned compactSampleRate = 22050;
+
+    // Ses dosyasını arka planda çöz ve sıkıştır => // Decode and compact a sound file in the background
+    void load(SoundClip& clip, const std::filesystem::path& path);
+    // Müzik akışını arka planda aç (yalnızca başlık okunur); hazır olana kadar müziğe dokunma
+    // Open a music stream in the background (only the header is read); do not touch the music until it is ready
+    std::shared_future<bool> open(sf::Music& music, const std::filesystem::path& path);
+
+    // Aynıları, bellekteki (ör. eşlenmiş arşiv) bir dosyadan; bellek kopyalanmaz, müzik
+    // çaldığı sürece geçerli kalmalıdır. name yalnızca hata mesajları içindir.
+    // The same, from a file in memory (e.g. a mapped archive); the bytes are not
+    // copied and must stay valid while the music plays. name is only for error messages.
+    void load(SoundClip& clip, const void* data, size_t size, const std::string& name);
+    std::shared_future<bool> open(sf::Music& music, const void* data, size_t size);
+
+private:
+    ThreadPool pool;
+};
@@ -0,0 +1,50 @@
+// Varlık paketleme aracı: bir dizindeki (ya da verilen) dosyaları tek arşive yazar
+// Asset pack tool: writes the files in a directory (or the given files) into one archive
+//
+//   myGamePack assets.pak sounds
+//   myGamePack assets.pak sounds/collision.wav sounds/pickup.wav ...
+#include "asset_archive.h"
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " OUTPUT.pak DIRECTORY|FILE..." << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> files;
+    for (int i = 2; i < argc; i++) {
+        std::filesystem::path input = argv[i];
+        if (std::filesystem::is_directory(input)) {
+            for (const auto& item : std::filesystem::directory_iterator(input)) {
+                // Gizli dosyalar (.DS_Store vb.) paketlenmez => // Hidden files (.DS_Store etc.) are skipped
+                if (item.is_regular_file() && item.path().filename().string()[0] != '.') {
+                    files.push_back(item.path().string());
+                }
+            }
+        } else {
+            files.push_back(input.string());
+        }
+    }
+    // Aynı girdiler aynı arşivi üretsin => // Same inputs, same archive
+    std::sort(files.begin(), files.end());
+
+    if (!AssetArchive::pack(files, argv[1])) {
+        std::cerr << "Failed to write archive: " << argv[1] << std::endl;
+        return 1;
+    }
+
+    // Yazılan arşivi eşleyerek doğrula => // Verify the written archive by mapping it
+    AssetArchive archive;
+    if (!archive.open(argv[1])) {
+        return 1;
+    }
+    for (size_t i = 0; i < archive.entryCount(); i++) {
+        AssetView view = archive.find(archive.entryName(i));
+        std::cout << "  " << archive.entryName(i) << " (" << view.size << " bytes)" << std::endl;
+    }
+    std::cout << "Packed " << archive.entryCount() << " assets into " << argv[1] << std::endl;
+    return 0;
+}
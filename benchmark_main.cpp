@@ -0,0 +1,438 @@
+// Sıcak çekirdekler için mikro benchmark (GLFW/GLEW/SFML gerektirmez)
+// Microbenchmarks for the hot kernels (no GLFW/GLEW/SFML needed)
+//
+//   ./compile bench
+//   myGameBenchmark [--min N] [--max N] [--filter NAME]
+//                   [--baseline FILE] [--write-baseline FILE] [--tolerance PCT]
+//
+// Her çekirdek 10'dan 1M'ye kadar varlık sayısıyla çalıştırılır; varlık başına
+// ns ve yineleme başına heap ayırması raporlanır. --baseline ile kayıtlı
+// sonuçlarla karşılaştırılır; tolerans dışı yavaşlama ya da yeni ayırma varsa
+// çıkış kodu 1'dir.
+// Every kernel runs at entity counts from 10 to 1M; ns per entity and heap
+// allocations per iteration are reported. --baseline compares against stored
+// results; a slowdown beyond the tolerance or any new allocation exits with 1.
+#include "game_simulation.h"
+#include "text_layout.h"
+#include "job_system.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <new>
+
+// Ayırma sayacı: global operator new tüm heap ayırmalarını sayar
+// Allocation counter: the global operator new counts every heap allocation
+static std::atomic<uint64_t> allocationCount{0};
+static std::atomic<uint64_t> allocationBytes{0};
+
+void* operator new(size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationBytes.fetch_add(size, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+// Yineleme başına en az bu kadar varlık işlenir (küçük N'de ölçüm gürültüsünü azaltır)
+// At least this many entities are processed per repeat (reduces noise at small N)
+const size_t TARGET_ENTITIES = 2000000;
+const int REPEATS = 5;
+
+struct BenchResult {
+    std::string name;
+    size_t count = 0;
+    double nsPerEntity = 0.0;
+    double allocsPerIteration = 0.0;
+    double bytesPerIteration = 0.0;
+};
+
+// Bir benchmark: hazırlık (zamanlanmaz) ve ölçülen gövde; gövde işlediği varlık sayısını döner
+// One benchmark: setup (not timed) and the measured body; the body returns how many entities it processed
+struct Benchmark {
+    const char* name;
+    void (*setup)(GameSimulation& sim, size_t count);
+    size_t (*run)(GameSimulation& sim, size_t count);
+};
+
+// Optimizasyonun gövdeyi silmemesi için sonuçlar buraya yazılır => // Results are sunk here so the body is not optimized away
+static volatile float benchmarkSink = 0.0f;
+
+// --- Parçacık güncellemesi => // Particle update ---
+static void setupParticles(GameSimulation& sim, size_t count) {
+    sim.particles.setCapacity(count);
+    for (size_t i = 0; i < count; i++) {
+        float u[6];
+        sim.cosmeticRng.fill(u, 6);
+        // Yatay hız 0: sürtünme onu binlerce adımda denormal sayılara indirip ölçümü bozardı
+        // Zero horizontal speed: drag would decay it into denormals over thousands of steps and skew the timing
+        sim.particles.spawn(u[0] * 2.0f - 1.0f, u[1] * 2.0f - 1.0f, 0.0f, u[3] - 0.5f,
+                            1.0f, 0.5f, 0.2f, 1.0f, 1.0e9f, 0.02f + u[4] * 0.05f,
+                            u[5] * 360.0f, 90.0f);
+    }
+}
+
+static size_t runParticles(GameSimulation& sim, size_t) {
+    // dt = 0: aynı komutlar çalışır ama parçacıklar yerinde kalır; yerçekimi onları
+    // yoksa birkaç saniyede ekrandan düşürür ve ölçülen sayı azalırdı
+    // dt = 0: the same instructions run but particles stay put; otherwise gravity
+    // drops them off screen within seconds and the measured count shrinks
+    sim.updateParticles(0.0f);
+    benchmarkSink = sim.particles.x[0];
+    return sim.particles.size();
+}
+
+// Aynı güncelleme tüm çekirdeklere bölünmüş halde; sonuç tek iş parçacıklıyla aynıdır
+// The same update split over all cores; the result matches the single-threaded one
+static JobSystem& benchmarkJobs() {
+    static JobSystem jobs;
+    return jobs;
+}
+
+static void setupParticlesJobs(GameSimulation& sim, size_t count) {
+    setupParticles(sim, count);
+    sim.jobs = &benchmarkJobs();
+}
+
+// --- Patlamalar: varlık = üretilen parçacık => // Explosions: entity = spawned particle ---
+const size_t BLOCK_EXPLOSION_PARTICLES = 20;
+const size_t MASSIVE_EXPLOSION_PARTICLES = 190;
+
+static void setupExplosions(GameSimulation& sim, size_t count) {
+    // En az bir patlama sığsın; dolu depo ölçüme tahliye maliyeti katardı
+    // Room for at least one explosion; a full store would add eviction cost
+    sim.particles.setCapacity(std::max(count, MASSIVE_EXPLOSION_PARTICLES));
+}
+
+static size_t runBlockExplosion(GameSimulation& sim, size_t count) {
+    sim.particles.clear();
+    size_t explosions = std::max<size_t>(1, count / BLOCK_EXPLOSION_PARTICLES);
+    for (size_t i = 0; i < explosions; i++) {
+        sim.createBlockExplosion(0.1f, 0.2f, 0.8f, 0.2f, 0.1f);
+    }
+    return explosions * BLOCK_EXPLOSION_PARTICLES;
+}
+
+static size_t runMassiveExplosion(GameSimulation& sim, size_t count) {
+    sim.particles.clear();
+    size_t explosions = std::max<size_t>(1, count / MASSIVE_EXPLOSION_PARTICLES);
+    for (size_t i = 0; i < explosions; i++) {
+        sim.createMassiveExplosion(0.0f, 0.0f, 0.3f);
+    }
+    return explosions * MASSIVE_EXPLOSION_PARTICLES;
+}
+
+// --- Blok hareketi => // Block movement ---
+static void fillBlocks(GameSimulation& sim, size_t count) {
+    sim.blocks.clear();
+    sim.blocks.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        float u[2];
+        sim.spawnRng.fill(u, 2, -1.0f, 1.0f);
+        // Üç hareket deseni karışık => // All three movement patterns mixed
+        sim.addBlock(u[0], u[1], (int)(i % 3), 0.8f, 0.1f, 0.1f, (int)(i % 3), u[0]);
+    }
+}
+
+static void setupBlockMovement(GameSimulation& sim, size_t count) {
+    sim.level = 5; // Level 3 tüm desenleri doğrusala çevirir => // Level 3 forces every pattern to linear
+    fillBlocks(sim, count);
+}
+
+static size_t runBlockMovement(GameSimulation& sim, size_t) {
+    for (size_t row = 0; row < sim.blocks.size(); row++) {
+        sim.updateBlockMovement(row);
+    }
+    benchmarkSink = sim.blocks.at<Position>(0).x;
+    return sim.blocks.size();
+}
+
+// --- Geniş faz çarpışma: N blok + N power-up => // Broadphase collision: N blocks + N power-ups ---
+static void setupCollision(GameSimulation& sim, size_t count) {
+    fillBlocks(sim, count);
+    sim.powerUps.clear();
+    sim.powerUps.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        float u[2];
+        sim.spawnRng.fill(u, 2, -1.0f, 1.0f);
+        sim.addPowerUp(u[0], u[1], (int)(i % 6) + 1);
+    }
+    sim.blockGrid.reserve(count);
+    sim.powerUpGrid.reserve(count);
+    sim.collisionCandidates.reserve(count);
+}
+
+static size_t runCollision(GameSimulation& sim, size_t) {
+    sim.findPowerUpCollisions();
+    size_t hits = sim.collisionCandidates.size();
+    sim.findBlockCollisions();
+    benchmarkSink = (float)(hits + sim.collisionCandidates.size());
+    return sim.blocks.size() + sim.powerUps.size();
+}
+
+// --- Süreli etkiler: varlık başına bir etki, biten her etki yeniden uygulanır => // Timed effects: one per entity, every expiring effect is reapplied ---
+static int benchmarkEffect = -1;
+
+static void setupEffects(GameSimulation& sim, size_t count) {
+    GameSimulation* target = &sim;
+    benchmarkEffect = sim.effects.addType(EffectStacking::Refresh, nullptr, [target](uint32_t entity) {
+        target->effects.apply(benchmarkEffect, 1.0f + target->spawnRng.range(10), entity);
+    });
+    sim.effects.reserve(count + 16);
+    for (size_t i = 0; i < count; i++) {
+        sim.effects.apply(benchmarkEffect, 1.0f + sim.spawnRng.range(10), (uint32_t)i);
+    }
+    // Kararlı duruma gel: en uzun süre (10 s) bir kez dolsun => // Reach steady state: let the longest duration (10 s) run out once
+    for (int i = 0; i < 11 * 60; i++) {
+        sim.effects.tick();
+    }
+}
+
+static size_t runEffects(GameSimulation& sim, size_t count) {
+    // Bir simülasyon saniyesi; adım maliyeti etkin etkiye değil biten etkiye bağlı
+    // One simulated second; step cost depends on expiring effects, not active ones
+    for (int i = 0; i < 60; i++) {
+        sim.effects.tick();
+    }
+    benchmarkSink = (float)sim.effects.activeCount();
+    return count * 60;
+}
+
+// --- Metin yerleşimi: varlık = karakter => // Text layout: entity = character ---
+static std::string layoutSource;
+static std::vector<TextVertex> layoutVertices;
+
+static void setupTextLayout(GameSimulation&, size_t count) {
+    // HUD benzeri satırlar => // HUD-like lines
+    const std::string line = "Score: 1234  Level: 7  Health: 3\n";
+    layoutSource.clear();
+    while (layoutSource.size() < count) {
+        layoutSource += line;
+    }
+    layoutSource.resize(count);
+    layoutVertices.clear();
+    layoutVertices.reserve(count * 4);
+}
+
+static size_t runTextLayout(GameSimulation&, size_t) {
+    layoutVertices.clear();
+    layoutText(layoutSource, 0.05f, layoutVertices);
+    benchmarkSink = layoutVertices.empty() ? 0.0f : layoutVertices.back().x;
+    return layoutSource.size();
+}
+
+static const Benchmark BENCHMARKS[] = {
+    {"updateParticles", setupParticles, runParticles},
+    {"updateParticlesJobs", setupParticlesJobs, runParticles},
+    {"createBlockExplosion", setupExplosions, runBlockExplosion},
+    {"createMassiveExplosion", setupExplosions, runMassiveExplosion},
+    {"updateBlockMovement", setupBlockMovement, runBlockMovement},
+    {"collision", setupCollision, runCollision},
+    {"effectTick", setupEffects, runEffects},
+    {"layoutText", setupTextLayout, runTextLayout},
+};
+
+static BenchResult measure(const Benchmark& bench, size_t count) {
+    GameSimulation sim;
+    sim.logEvents = false;
+    sim.seed(1);
+    bench.setup(sim, count);
+
+    // Isınma: önbellekler ve tek seferlik ayırmalar => // Warm-up: caches and one-off allocations
+    size_t perIteration = bench.run(sim, count);
+    size_t iterations = std::max<size_t>(1, TARGET_ENTITIES / std::max<size_t>(1, perIteration));
+
+    std::vector<double> samples;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+    for (int repeat = 0; repeat < REPEATS; repeat++) {
+        uint64_t allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+        uint64_t bytesBefore = allocationBytes.load(std::memory_order_relaxed);
+        size_t entities = 0;
+
+        auto begin = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            entities += bench.run(sim, count);
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        allocations += allocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+        bytes += allocationBytes.load(std::memory_order_relaxed) - bytesBefore;
+        double ns = std::chrono::duration<double, std::nano>(end - begin).count();
+        samples.push_back(ns / (double)std::max<size_t>(1, entities));
+    }
+
+    // Ortanca, tek bir kesintiden etkilenmez => // The median is not thrown off by a single interruption
+    std::sort(samples.begin(), samples.end());
+    BenchResult result;
+    result.name = bench.name;
+    result.count = count;
+    result.nsPerEntity = samples[samples.size() / 2];
+    result.allocsPerIteration = (double)allocations / (double)(iterations * REPEATS);
+    result.bytesPerIteration = (double)bytes / (double)(iterations * REPEATS);
+    return result;
+}
+
+// Baseline dosyası: satır başına bir sonuç nesnesi (elle düzenlenebilir, satır satır okunur)
+// Baseline file: one result object per line (hand-editable, read line by line)
+static bool writeBaseline(const std::string& path, const std::vector<BenchResult>& results) {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    out << "{\n  \"kernel\": \"" << ParticleSystem::kernelName() << "\",\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        char line[256];
+        std::snprintf(line, sizeof(line),
+                      "    {\"name\": \"%s\", \"count\": %zu, \"nsPerEntity\": %.4f, \"allocsPerIteration\": %.4f}%s\n",
+                      r.name.c_str(), r.count, r.nsPerEntity, r.allocsPerIteration,
+                      i + 1 < results.size() ? "," : "");
+        out << line;
+    }
+    out << "  ]\n}\n";
+    return (bool)out;
+}
+
+// "key": değerini bul; yoksa false => // Find "key": value; false if missing
+static bool findJsonField(const std::string& line, const char* key, std::string& value) {
+    std::string pattern = std::string("\"") + key + "\":";
+    size_t pos = line.find(pattern);
+    if (pos == std::string::npos) {
+        return false;
+    }
+    pos += pattern.size();
+    while (pos < line.size() && line[pos] == ' ') pos++;
+    if (pos < line.size() && line[pos] == '"') {
+        size_t end = line.find('"', pos + 1);
+        if (end == std::string::npos) return false;
+        value = line.substr(pos + 1, end - pos - 1);
+    } else {
+        size_t end = line.find_first_of(",}", pos);
+        value = line.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+    }
+    return true;
+}
+
+static bool loadBaseline(const std::string& path, std::vector<BenchResult>& results) {
+    std::ifstream in(path);
+    if (!in) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+        std::string name, count, ns, allocs;
+        if (!findJsonField(line, "name", name) || !findJsonField(line, "count", count) ||
+            !findJsonField(line, "nsPerEntity", ns)) {
+            continue;
+        }
+        BenchResult r;
+        r.name = name;
+        r.count = (size_t)std::strtoull(count.c_str(), nullptr, 10);
+        r.nsPerEntity = std::atof(ns.c_str());
+        if (findJsonField(line, "allocsPerIteration", allocs)) {
+            r.allocsPerIteration = std::atof(allocs.c_str());
+        }
+        results.push_back(r);
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    size_t minCount = 10;
+    size_t maxCount = 1000000;
+    std::string filter;
+    std::string baselinePath;
+    std::string writePath;
+    double tolerance = 10.0; // Yüzde => // Percent
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--min") == 0 && i + 1 < argc) {
+            minCount = (size_t)std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--max") == 0 && i + 1 < argc) {
+            maxCount = (size_t)std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baselinePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--write-baseline") == 0 && i + 1 < argc) {
+            writePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = std::atof(argv[++i]);
+        } else {
+            std::cerr << "Unknown argument: " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<BenchResult> baseline;
+    if (!baselinePath.empty() && !loadBaseline(baselinePath, baseline)) {
+        std::cerr << "Failed to read baseline: " << baselinePath << std::endl;
+        return 1;
+    }
+
+    std::cout << "Particle kernel: " << ParticleSystem::kernelName()
+              << " | Job threads: " << benchmarkJobs().workerCount() + 1 << std::endl;
+    std::printf("%-24s %9s %12s %12s %14s %10s\n", "benchmark", "count", "ns/entity", "allocs/iter", "bytes/iter", "vs base");
+
+    std::vector<BenchResult> results;
+    int regressions = 0;
+    for (const Benchmark& bench : BENCHMARKS) {
+        if (!filter.empty() && std::string(bench.name).find(filter) == std::string::npos) {
+            continue;
+        }
+        for (size_t count = minCount; count <= maxCount; count *= 10) {
+            BenchResult r = measure(bench, count);
+            results.push_back(r);
+
+            char delta[32] = "-";
+            for (const BenchResult& base : baseline) {
+                if (base.name != r.name || base.count != r.count) {
+                    continue;
+                }
+                double change = (r.nsPerEntity / base.nsPerEntity - 1.0) * 100.0;
+                bool slower = change > tolerance;
+                bool allocates = r.allocsPerIteration > base.allocsPerIteration + 0.01;
+                std::snprintf(delta, sizeof(delta), "%+.1f%%%s", change,
+                              slower ? " SLOWER" : (allocates ? " ALLOC" : ""));
+                if (slower || allocates) {
+                    regressions++;
+                }
+                break;
+            }
+            std::printf("%-24s %9zu %12.3f %12.2f %14.0f %10s\n", r.name.c_str(), r.count,
+                        r.nsPerEntity, r.allocsPerIteration, r.bytesPerIteration, delta);
+        }
+    }
+
+    if (!writePath.empty()) {
+        if (!writeBaseline(writePath, results)) {
+            std::cerr << "Failed to write baseline: " << writePath << std::endl;
+            return 1;
+        }
+        std::cout << "Baseline written: " << writePath << std::endl;
+    }
+
+    if (!baseline.empty()) {
+        std::cout << "Regressions (tolerance " << tolerance << "%): " << regressions << std::endl;
+        return regressions > 0 ? 1 : 0;
+    }
+    return 0;
+}
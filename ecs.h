@@ -0,0 +1,128 @@
+#pragma once
+
+// Hafif varlık-bileşen (ECS) deposu: arketip başına bileşen dizileri (SoA).
+// Lightweight entity-component storage: per-archetype component arrays (SoA).
+//
+// Bir arketip aynı bileşen kümesine sahip varlıkları tutar (ör. tüm bloklar).
+// Her bileşen kendi bitişik dizisindedir ve varlık bir satır indeksidir; sistemler
+// yalnızca ihtiyaç duydukları dizileri gezer. Silme, ParticleSystem'deki gibi,
+// ya sonuncuyla yer değiştirerek (O(1), sıra bozulur) ya da sırayı koruyan
+// retain() ile yapılır. Sıra korunmalı olduğunda (replay'in birebir tekrarı için
+// çarpışmalar dizi sırasıyla uygulanır) retain() kullanılır.
+// An archetype holds every entity with the same set of components (e.g. all
+// blocks). Each component lives in its own contiguous array and an entity is
+// a row index; systems only walk the arrays they need. Removal is either a
+// swap with the last row (O(1), order changes), as in ParticleSystem, or the
+// order-preserving retain(). Use retain() where order matters (collisions are
+// applied in array order so replays stay bit-exact).
+//
+// Bileşen türleri bir arketipte benzersiz olmalıdır; get<Position>() türle seçer.
+// Component types must be unique within an archetype; get<Position>() selects by type.
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Ortak bileşenler => // Shared components
+struct Position {
+    float x, y;
+};
+
+// Önceki simülasyon adımındaki pozisyon (çizim interpolasyonu için)
+// Position at the previous simulation step (for render interpolation)
+struct PrevPosition {
+    float x, y;
+};
+
+// Dünya düşüş hızına göre ölçekli hız; bloklar ve power-up'lar (0, -1) ile düşer
+// Velocity scaled by the world fall speed; blocks and power-ups fall with (0, -1)
+struct Velocity {
+    float x, y;
+};
+
+struct Color {
+    float r, g, b;
+};
+
+template <typename... Components>
+class Archetype {
+public:
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    void reserve(size_t capacity) {
+        (std::get<std::vector<Components>>(columns).reserve(capacity), ...);
+    }
+
+    void clear() {
+        (std::get<std::vector<Components>>(columns).clear(), ...);
+        count = 0;
+    }
+
+    // Yeni satır ekle ve indeksini döndür => // Append a row and return its index
+    size_t add(const Components&... values) {
+        (std::get<std::vector<Components>>(columns).push_back(values), ...);
+        return count++;
+    }
+
+    // Satırı sonuncuyla değiştirerek sil => // Remove a row by swapping it with the last
+    void removeSwap(size_t row) {
+        size_t last = count - 1;
+        if (row != last) {
+            ((std::get<std::vector<Components>>(columns)[row] = std::get<std::vector<Components>>(columns)[last]), ...);
+        }
+        truncate(last);
+    }
+
+    // keep(row) true dönen satırları sırayı koruyarak tut => // Keep the rows where keep(row) is true, preserving order
+    template <typename Keep>
+    void retain(Keep&& keep) {
+        size_t kept = 0;
+        for (size_t row = 0; row < count; row++) {
+            if (!keep(row)) {
+                continue;
+            }
+            if (kept != row) {
+                ((std::get<std::vector<Components>>(columns)[kept] = std::get<std::vector<Components>>(columns)[row]), ...);
+            }
+            kept++;
+        }
+        truncate(kept);
+    }
+
+    // İlk n satırı tut => // Keep the first n rows
+    void truncate(size_t n) {
+        if (n >= count) {
+            return;
+        }
+        (std::get<std::vector<Components>>(columns).resize(n), ...);
+        count = n;
+    }
+
+    // Bileşen dizisi; yalnızca [0, size()) geçerlidir => // Component array; only [0, size()) is valid
+    template <typename Component>
+    std::vector<Component>& get() { return std::get<std::vector<Component>>(columns); }
+    template <typename Component>
+    const std::vector<Component>& get() const { return std::get<std::vector<Component>>(columns); }
+
+    // Tek satırın bileşeni => // One row's component
+    template <typename Component>
+    Component& at(size_t row) { return std::get<std::vector<Component>>(columns)[row]; }
+    template <typename Component>
+    const Component& at(size_t row) const { return std::get<std::vector<Component>>(columns)[row]; }
+
+    // Seçilen bileşenlerle her satırı ziyaret et: fn(Position&, Velocity&, ...)
+    // Visit every row with the selected components: fn(Position&, Velocity&, ...)
+    template <typename... Selected, typename Fn>
+    void each(Fn&& fn) {
+        auto arrays = std::make_tuple(std::get<std::vector<Selected>>(columns).data()...);
+        for (size_t row = 0; row < count; row++) {
+            fn(std::get<Selected*>(arrays)[row]...);
+        }
+    }
+
+private:
+    std::tuple<std::vector<Components>...> columns;
+    size_t count = 0;
+};
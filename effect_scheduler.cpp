@@ -0,0 +1,230 @@
+#include "effect_scheduler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+// Zamanlayıcı yükü: 24 bit dönem | 8 bit tür | 32 bit hedef
+// Timer payload: 24-bit epoch | 8-bit type | 32-bit target
+static uint64_t makePayload(uint64_t key, uint32_t epoch) {
+    return ((uint64_t)(epoch & 0xFFFFFFu) << 40) | key;
+}
+
+EffectScheduler::EffectScheduler(float tickSeconds) : tickSeconds(tickSeconds) {
+    for (TickCacheEntry& entry : tickCache) {
+        entry = { -1.0f, 0 };
+    }
+}
+
+size_t EffectScheduler::home(uint64_t id) const {
+    return (size_t)((id * 0x9E3779B97F4A7C15ULL) >> 32) & (table.size() - 1);
+}
+
+EffectScheduler::Instance* EffectScheduler::find(uint64_t id) {
+    return const_cast<Instance*>(static_cast<const EffectScheduler*>(this)->find(id));
+}
+
+const EffectScheduler::Instance* EffectScheduler::find(uint64_t id) const {
+    if (table.empty()) {
+        return nullptr;
+    }
+    for (size_t slot = home(id);; slot = (slot + 1) & (table.size() - 1)) {
+        if (!table[slot].used) {
+            return nullptr;
+        }
+        if (table[slot].key == id) {
+            return &table[slot].instance;
+        }
+    }
+}
+
+EffectScheduler::Instance& EffectScheduler::insert(uint64_t id) {
+    // Doluluk en fazla %50 => // Load factor at most 50%
+    if ((instanceCount + 1) * 2 > table.size()) {
+        grow(std::max<size_t>(16, table.size() * 2));
+    }
+    size_t slot = home(id);
+    while (table[slot].used) {
+        slot = (slot + 1) & (table.size() - 1);
+    }
+    table[slot].used = true;
+    table[slot].key = id;
+    instanceCount++;
+    return table[slot].instance;
+}
+
+// Silinen yuvadan sonraki kümeyi geri kaydır; mezar taşı kullanılmaz
+// Shift the following cluster back into the freed slot; no tombstones
+void EffectScheduler::erase(uint64_t id) {
+    const size_t mask = table.size() - 1;
+    size_t hole = home(id);
+    while (table[hole].key != id || !table[hole].used) {
+        hole = (hole + 1) & mask;
+    }
+    for (size_t slot = (hole + 1) & mask; table[slot].used; slot = (slot + 1) & mask) {
+        size_t want = home(table[slot].key);
+        // want, (hole, slot] aralığında değilse kaydırılabilir => // Movable unless want lies in (hole, slot]
+        if (((slot - want) & mask) >= ((slot - hole) & mask)) {
+            table[hole] = table[slot];
+            hole = slot;
+        }
+    }
+    table[hole].used = false;
+    instanceCount--;
+}
+
+void EffectScheduler::grow(size_t capacity) {
+    std::vector<Slot> old;
+    old.swap(table);
+    table.assign(capacity, Slot{0, {INVALID_TIMER, 0, 0}, false});
+    instanceCount = 0;
+    for (const Slot& entry : old) {
+        if (entry.used) {
+            insert(entry.key) = entry.instance;
+        }
+    }
+}
+
+int EffectScheduler::addType(EffectStacking stacking, EffectCallback onApply, EffectCallback onExpire) {
+    // Tür, anahtarda ve zamanlayıcı yükünde 8 bit => // The type is 8 bits in the key and the timer payload
+    if (types.size() >= MAX_TYPES) {
+        std::cerr << "EffectScheduler: more than " << MAX_TYPES << " effect types" << std::endl;
+        return -1;
+    }
+    EffectType type;
+    type.stacking = stacking;
+    type.onApply = std::move(onApply);
+    type.onExpire = std::move(onExpire);
+    types.push_back(std::move(type));
+    return (int)types.size() - 1;
+}
+
+void EffectScheduler::reserve(size_t effects) {
+    wheel.reserve(effects);
+    size_t capacity = 16;
+    while (capacity < effects * 2) {
+        capacity *= 2;
+    }
+    if (capacity > table.size()) {
+        grow(capacity);
+    }
+}
+
+uint64_t EffectScheduler::ticksFor(float seconds) {
+    uint32_t bits;
+    std::memcpy(&bits, &seconds, sizeof(bits));
+    TickCacheEntry& entry = tickCache[(bits * 0x9E3779B1u) >> 27]; // Üst 5 bit => // Top 5 bits
+    if (seconds != entry.seconds) {
+        uint64_t ticks = 0;
+        if (!(seconds > 0.0f)) {
+            ticks = 0; // Negatif, sıfır ya da NaN => // Negative, zero or NaN
+        } else if (seconds <= EXACT_COUNTDOWN_TICKS * tickSeconds) {
+            // Kayan noktalı geri sayımı aynen taklit et; ceil(seconds / tickSeconds) birikmiş
+            // yuvarlama yüzünden bir adım kayabilir ve replay'leri bozardı
+            // Replay the floating-point countdown exactly; ceil(seconds / tickSeconds) can be
+            // one step off because of accumulated rounding, which would break replays
+            float left = seconds;
+            while (left > 0) {
+                left -= tickSeconds;
+                ticks++;
+            }
+        } else {
+            // Uzun sürelerde döngü pahalı, çok büyüklerde hiç bitmez (left - tickSeconds == left)
+            // For long durations the loop is costly, and for huge ones it never ends (left - tickSeconds == left)
+            double exact = std::ceil((double)seconds / tickSeconds);
+            ticks = exact < (double)MAX_EFFECT_TICKS ? (uint64_t)exact : MAX_EFFECT_TICKS;
+        }
+        entry = { seconds, ticks };
+    }
+    return entry.ticks;
+}
+
+void EffectScheduler::apply(int type, float seconds, uint32_t target) {
+    if (type < 0 || (size_t)type >= types.size()) {
+        return;
+    }
+    const EffectType& info = types[type];
+    const uint64_t ticks = ticksFor(seconds);
+    const uint64_t id = key(type, target);
+
+    Instance* found = find(id);
+    if (!found) {
+        uint32_t epoch = nextEpoch++;
+        TimerId timer = wheel.schedule(ticks, makePayload(id, epoch));
+        insert(id) = { timer, 1, epoch };
+    } else {
+        Instance& instance = *found;
+        switch (info.stacking) {
+            case EffectStacking::Refresh:
+                wheel.reschedule(instance.timer, ticks);
+                break;
+            case EffectStacking::Extend:
+                wheel.reschedule(instance.timer, wheel.remaining(instance.timer) + ticks);
+                break;
+            case EffectStacking::Stack:
+                instance.timer = wheel.schedule(ticks, makePayload(id, instance.epoch));
+                instance.stacks++;
+                break;
+        }
+    }
+
+    if (info.onApply) {
+        info.onApply(target);
+    }
+}
+
+bool EffectScheduler::cancel(int type, uint32_t target) {
+    const uint64_t id = key(type, target);
+    Instance* found = find(id);
+    if (!found) {
+        return false;
+    }
+    // Stack'in eski kopyaları dönem uyuşmadığı için dolduklarında yok sayılır
+    // Older Stack copies are ignored when they fire because their epoch no longer matches
+    wheel.cancel(found->timer);
+    erase(id);
+    return true;
+}
+
+bool EffectScheduler::isActive(int type, uint32_t target) const {
+    return find(key(type, target)) != nullptr;
+}
+
+uint32_t EffectScheduler::stacks(int type, uint32_t target) const {
+    const Instance* found = find(key(type, target));
+    return found ? found->stacks : 0;
+}
+
+float EffectScheduler::remaining(int type, uint32_t target) const {
+    const Instance* found = find(key(type, target));
+    return found ? wheel.remaining(found->timer) * tickSeconds : 0.0f;
+}
+
+void EffectScheduler::tick() {
+    wheel.advance([this](uint64_t payload) {
+        const uint64_t id = payload & 0xFFFFFFFFFFULL;
+        const uint32_t epoch = (uint32_t)(payload >> 40);
+        Instance* found = find(id);
+        if (!found || (found->epoch & 0xFFFFFFu) != epoch) {
+            return; // İptal edilmiş bir kopya => // A cancelled copy
+        }
+        if (--found->stacks == 0) {
+            erase(id);
+        }
+        // Geri çağrı yeni etki uygulayabilir; kayıt önceden güncellendi
+        // The callback may apply new effects; the record is already up to date
+        const int type = (int)((id >> 32) & 0xFF);
+        const uint32_t target = (uint32_t)id;
+        if (types[type].onExpire) {
+            types[type].onExpire(target);
+        }
+    });
+}
+
+void EffectScheduler::clear() {
+    wheel.clear();
+    for (Slot& slot : table) {
+        slot.used = false;
+    }
+    instanceCount = 0;
+}
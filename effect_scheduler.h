@@ -0,0 +1,117 @@
+#pragma once
+
+// Süreli etkiler (güç-artırmalar, durum etkileri) için zamanlayıcı.
+// Scheduler for timed effects (power-ups, status effects).
+//
+// Her etki türü bir kez kaydedilir: üst üste binme kuralı ve uygulanma/bitiş geri
+// çağrıları. Etkiler (tür, hedef) çiftiyle tutulur; hedef oyun geneli etkiler için
+// 0, varlık başına etkiler için varlık kimliğidir. Süreler TimerWheel'de tik olarak
+// bekler, bu yüzden tick() yalnızca o adımda biten etkilere dokunur; binlerce etkin
+// etki her adım taranmaz.
+// Every effect type is registered once: its stacking rule and apply/expire
+// callbacks. Effects are keyed by (type, target); the target is 0 for global
+// effects and an entity id for per-entity ones. Durations wait in a TimerWheel
+// as ticks, so tick() only touches the effects that end on that step; thousands
+// of active effects are not scanned every step.
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "timer_wheel.h"
+
+enum class EffectStacking : uint8_t {
+    Refresh, // Yeniden uygulama süreyi baştan başlatır => // Reapplying restarts the duration
+    Extend,  // Yeniden uygulama süreyi uzatır => // Reapplying adds to the remaining time
+    Stack    // Her uygulama ayrı süreli bir kopya; en az biri sürdükçe etkin => // Every application is a separately timed copy; active while any copy lasts
+};
+
+using EffectCallback = std::function<void(uint32_t target)>;
+
+class EffectScheduler {
+public:
+    // tickSeconds: bir tick() çağrısının temsil ettiği süre => // tickSeconds: the time one tick() call stands for
+    explicit EffectScheduler(float tickSeconds);
+
+    // Türü kaydet ve kimliğini döndür (0, 1, 2... sırayla); en fazla 256 tür, fazlası -1
+    // onApply her uygulamada (yenilemede de), onExpire her kopyanın süresi dolunca çağrılır
+    // Register a type and return its id (0, 1, 2... in order); at most 256 types, -1 beyond that
+    // onApply runs on every application (refreshes too), onExpire when a copy runs out
+    int addType(EffectStacking stacking, EffectCallback onApply = nullptr, EffectCallback onExpire = nullptr);
+
+    void reserve(size_t effects);
+
+    void apply(int type, float seconds, uint32_t target = 0);
+    // Etkiyi tüm kopyalarıyla bitiş geri çağrısı olmadan kaldır (ör. kırılan kalkan)
+    // Remove the effect with all its copies without the expire callback (e.g. a broken shield)
+    bool cancel(int type, uint32_t target = 0);
+
+    bool isActive(int type, uint32_t target = 0) const;
+    // Etkin kopya sayısı => // Number of active copies
+    uint32_t stacks(int type, uint32_t target = 0) const;
+    // En son uygulanan kopyanın kalan süresi (saniye) => // Remaining time of the most recent copy (seconds)
+    float remaining(int type, uint32_t target = 0) const;
+
+    // Bir adım ilerle ve biten etkilerin onExpire'ını çağır => // Advance one step and run onExpire for the effects that end
+    void tick();
+    // Her şeyi geri çağrısız sil => // Drop everything without callbacks
+    void clear();
+
+    // Etkin (tür, hedef) çifti sayısı => // Number of active (type, target) pairs
+    size_t activeCount() const { return instanceCount; }
+
+    // Saniyeyi tike çevir: her adım tickSeconds düşen bir sayacın sıfıra indiği adım.
+    // EXACT_COUNTDOWN_TICKS'ten uzun süreler ceil ile çevrilir ve MAX_EFFECT_TICKS'te kesilir.
+    // Seconds to ticks: the step on which a counter losing tickSeconds per step reaches zero.
+    // Durations longer than EXACT_COUNTDOWN_TICKS use ceil and are clamped to MAX_EFFECT_TICKS.
+    uint64_t ticksFor(float seconds);
+
+    static const size_t MAX_TYPES = 256;
+    static const uint64_t EXACT_COUNTDOWN_TICKS = 4096;    // 60 Hz'de ~68 s => // ~68 s at 60 Hz
+    static const uint64_t MAX_EFFECT_TICKS = 1ULL << 48;   // Pratikte kalıcı => // Permanent in practice
+
+private:
+    struct EffectType {
+        EffectStacking stacking;
+        EffectCallback onApply;
+        EffectCallback onExpire;
+    };
+
+    // Çevrilmiş süreler için doğrudan eşlemeli önbellek; oyunlar birkaç sabit süre kullanır
+    // Direct-mapped cache of converted durations; games use a handful of fixed durations
+    static const size_t TICK_CACHE_SIZE = 32;
+    struct TickCacheEntry {
+        float seconds;
+        uint64_t ticks;
+    };
+
+    struct Instance {
+        TimerId timer;   // Tek kopyada zamanlayıcı, Stack'te en son kopyanınki
+        uint32_t stacks;
+        uint32_t epoch;  // İptal edilmiş kopyaların geç dolan zamanlayıcılarını ayırt eder
+    };
+
+    // Açık adresli tablo (doğrusal yoklama); yeniden uygulama kararlı durumda heap'e dokunmaz
+    // Open-addressing table (linear probing); reapplying never touches the heap in steady state
+    struct Slot {
+        uint64_t key;
+        Instance instance;
+        bool used;
+    };
+
+    static uint64_t key(int type, uint32_t target) { return ((uint64_t)(uint8_t)type << 32) | target; }
+    size_t home(uint64_t id) const;
+    Instance* find(uint64_t id);
+    const Instance* find(uint64_t id) const;
+    Instance& insert(uint64_t id);
+    void erase(uint64_t id);
+    void grow(size_t capacity);
+
+    float tickSeconds;
+    TimerWheel wheel;
+    std::vector<EffectType> types;
+    TickCacheEntry tickCache[TICK_CACHE_SIZE];
+    std::vector<Slot> table;
+    size_t instanceCount = 0;
+    uint32_t nextEpoch = 0;
+};
@@ -0,0 +1,185 @@
+#pragma once
+
+// Derleme zamanında üretilen bitmap font atlası.
+// Compile-time baked bitmap font atlas.
+//
+// 5x7 glifler tek kanallı (8 bit) bir atlasa constexpr olarak yerleştirilir;
+// başlangıçta tek seferde dokuya yüklenir. Glif ölçüleri karakter koduyla
+// indekslenen düz bir 128 elemanlık dizidedir. GL bağımlılığı yoktur.
+// 5x7 glyphs are laid out into a single-channel (8-bit) atlas at compile time
+// and uploaded to a texture once at startup. Glyph metrics live in a flat
+// 128-entry array indexed by character code. No GL dependency.
+
+#include <array>
+#include <cstdint>
+
+const int FONT_FIRST_CHAR = 32;          // ' '
+const int FONT_LAST_CHAR = 126;          // '~'
+const int FONT_GLYPH_WIDTH = 5;          // Glif pikselleri
+const int FONT_GLYPH_HEIGHT = 7;
+const int FONT_CELL_WIDTH = 6;           // Sağda ve altta 1 piksel boşluk
+const int FONT_CELL_HEIGHT = 8;
+const int FONT_ATLAS_COLUMNS = 16;
+const int FONT_ATLAS_WIDTH = FONT_ATLAS_COLUMNS * FONT_CELL_WIDTH;   // 96
+const int FONT_ATLAS_HEIGHT = 6 * FONT_CELL_HEIGHT;                 // 48
+
+// Metin birimleri: bir hücre genişliği = 1 (renderText'in scale'i ile çarpılır)
+// Text units: one cell width = 1 (multiplied by renderText's scale)
+const float FONT_CELL_ASPECT = (float)FONT_CELL_HEIGHT / FONT_CELL_WIDTH;
+const float FONT_LINE_HEIGHT = FONT_CELL_ASPECT * 1.25f;
+
+// Her glif 7 satır; her satırın alt 5 biti soldan sağa pikseller
+// Each glyph is 7 rows; the low 5 bits of a row are the pixels, left to right
+constexpr uint8_t FONT_5X7[FONT_LAST_CHAR - FONT_FIRST_CHAR + 1][FONT_GLYPH_HEIGHT] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // ' '
+    {0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04}, // '!'
+    {0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00}, // '"'
+    {0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A}, // '#'
+    {0x04, 0x0F, 0x14, 0x0E, 0x05, 0x1E, 0x04}, // '$'
+    {0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03}, // '%'
+    {0x0C, 0x12, 0x14, 0x08, 0x15, 0x12, 0x0D}, // '&'
+    {0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00}, // '\''
+    {0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02}, // '('
+    {0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08}, // ')'
+    {0x00, 0x04, 0x15, 0x0E, 0x15, 0x04, 0x00}, // '*'
+    {0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00}, // '+'
+    {0x00, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x08}, // ','
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00}, // '-'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C}, // '.'
+    {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00}, // '/'
+    {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E}, // '0'
+    {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E}, // '1'
+    {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F}, // '2'
+    {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E}, // '3'
+    {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02}, // '4'
+    {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E}, // '5'
+    {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E}, // '6'
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}, // '7'
+    {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}, // '8'
+    {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C}, // '9'
+    {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00}, // ':'
+    {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x04, 0x08}, // ';'
+    {0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02}, // '<'
+    {0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00}, // '='
+    {0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08}, // '>'
+    {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, // '?'
+    {0x0E, 0x11, 0x01, 0x0D, 0x15, 0x15, 0x0E}, // '@'
+    {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}, // 'A'
+    {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E}, // 'B'
+    {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E}, // 'C'
+    {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C}, // 'D'
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F}, // 'E'
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10}, // 'F'
+    {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F}, // 'G'
+    {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}, // 'H'
+    {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E}, // 'I'
+    {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C}, // 'J'
+    {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11}, // 'K'
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F}, // 'L'
+    {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11}, // 'M'
+    {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11}, // 'N'
+    {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}, // 'O'
+    {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10}, // 'P'
+    {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D}, // 'Q'
+    {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11}, // 'R'
+    {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E}, // 'S'
+    {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}, // 'T'
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}, // 'U'
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04}, // 'V'
+    {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A}, // 'W'
+    {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11}, // 'X'
+    {0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04}, // 'Y'
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F}, // 'Z'
+    {0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E}, // '['
+    {0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00}, // '\\'
+    {0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E}, // ']'
+    {0x04, 0x0A, 0x11, 0x00, 0x00, 0x00, 0x00}, // '^'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F}, // '_'
+    {0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00}, // '`'
+    {0x00, 0x00, 0x0E, 0x01, 0x0F, 0x11, 0x0F}, // 'a'
+    {0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x1E}, // 'b'
+    {0x00, 0x00, 0x0E, 0x10, 0x10, 0x11, 0x0E}, // 'c'
+    {0x01, 0x01, 0x0D, 0x13, 0x11, 0x11, 0x0F}, // 'd'
+    {0x00, 0x00, 0x0E, 0x11, 0x1F, 0x10, 0x0E}, // 'e'
+    {0x06, 0x09, 0x08, 0x1C, 0x08, 0x08, 0x08}, // 'f'
+    {0x00, 0x0F, 0x11, 0x11, 0x0F, 0x01, 0x0E}, // 'g'
+    {0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x11}, // 'h'
+    {0x04, 0x00, 0x0C, 0x04, 0x04, 0x04, 0x0E}, // 'i'
+    {0x02, 0x00, 0x06, 0x02, 0x02, 0x12, 0x0C}, // 'j'
+    {0x10, 0x10, 0x12, 0x14, 0x18, 0x14, 0x12}, // 'k'
+    {0x0C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E}, // 'l'
+    {0x00, 0x00, 0x1A, 0x15, 0x15, 0x11, 0x11}, // 'm'
+    {0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x11}, // 'n'
+    {0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x0E}, // 'o'
+    {0x00, 0x00, 0x1E, 0x11, 0x1E, 0x10, 0x10}, // 'p'
+    {0x00, 0x00, 0x0D, 0x13, 0x0F, 0x01, 0x01}, // 'q'
+    {0x00, 0x00, 0x16, 0x19, 0x10, 0x10, 0x10}, // 'r'
+    {0x00, 0x00, 0x0E, 0x10, 0x0E, 0x01, 0x1E}, // 's'
+    {0x08, 0x08, 0x1C, 0x08, 0x08, 0x09, 0x06}, // 't'
+    {0x00, 0x00, 0x11, 0x11, 0x11, 0x13, 0x0D}, // 'u'
+    {0x00, 0x00, 0x11, 0x11, 0x11, 0x0A, 0x04}, // 'v'
+    {0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0A}, // 'w'
+    {0x00, 0x00, 0x11, 0x0A, 0x04, 0x0A, 0x11}, // 'x'
+    {0x00, 0x00, 0x11, 0x11, 0x0F, 0x01, 0x0E}, // 'y'
+    {0x00, 0x00, 0x1F, 0x02, 0x04, 0x08, 0x1F}, // 'z'
+    {0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02}, // '{'
+    {0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}, // '|'
+    {0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08}, // '}'
+    {0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00}, // '~'
+};
+
+struct FontGlyph {
+    float u0, v0, u1, v1; // Atlas doku koordinatları (v0 = üst)
+    float width, height;  // Dörtgen boyutu (metin birimi)
+    float advance;        // İmleç ilerlemesi
+    bool visible;         // Boşluk ve bilinmeyen karakterler çizilmez
+};
+
+constexpr std::array<uint8_t, FONT_ATLAS_WIDTH * FONT_ATLAS_HEIGHT> makeFontAtlas() {
+    std::array<uint8_t, FONT_ATLAS_WIDTH * FONT_ATLAS_HEIGHT> atlas{};
+    for (int c = FONT_FIRST_CHAR; c <= FONT_LAST_CHAR; c++) {
+        int cell = c - FONT_FIRST_CHAR;
+        int startX = (cell % FONT_ATLAS_COLUMNS) * FONT_CELL_WIDTH;
+        int startY = (cell / FONT_ATLAS_COLUMNS) * FONT_CELL_HEIGHT;
+        for (int y = 0; y < FONT_GLYPH_HEIGHT; y++) {
+            for (int x = 0; x < FONT_GLYPH_WIDTH; x++) {
+                bool set = (FONT_5X7[cell][y] >> (FONT_GLYPH_WIDTH - 1 - x)) & 1;
+                atlas[(startY + y) * FONT_ATLAS_WIDTH + startX + x] = set ? 255 : 0;
+            }
+        }
+    }
+    return atlas;
+}
+
+constexpr std::array<FontGlyph, 128> makeFontGlyphs() {
+    std::array<FontGlyph, 128> glyphs{};
+    for (int c = 0; c < 128; c++) {
+        FontGlyph glyph{};
+        glyph.advance = 1.0f;
+        if (c > FONT_FIRST_CHAR && c <= FONT_LAST_CHAR) {
+            int cell = c - FONT_FIRST_CHAR;
+            float startX = (float)((cell % FONT_ATLAS_COLUMNS) * FONT_CELL_WIDTH);
+            float startY = (float)((cell / FONT_ATLAS_COLUMNS) * FONT_CELL_HEIGHT);
+            glyph.u0 = startX / FONT_ATLAS_WIDTH;
+            glyph.v0 = startY / FONT_ATLAS_HEIGHT;
+            glyph.u1 = (startX + FONT_CELL_WIDTH) / FONT_ATLAS_WIDTH;
+            glyph.v1 = (startY + FONT_CELL_HEIGHT) / FONT_ATLAS_HEIGHT;
+            glyph.width = 1.0f;
+            glyph.height = FONT_CELL_ASPECT;
+            glyph.visible = true;
+        }
+        glyphs[c] = glyph;
+    }
+    return glyphs;
+}
+
+// Tek kanallı atlas pikselleri (0 = boş, 255 = dolu) => // Single-channel atlas pixels (0 = empty, 255 = set)
+inline constexpr std::array<uint8_t, FONT_ATLAS_WIDTH * FONT_ATLAS_HEIGHT> FONT_ATLAS = makeFontAtlas();
+// Karakter koduyla indekslenen glif ölçüleri => // Glyph metrics indexed by character code
+inline constexpr std::array<FontGlyph, 128> FONT_GLYPHS = makeFontGlyphs();
+
+// 128 ve üstü (ya da negatif char) boşluk gibi ilerler => // Codes >= 128 (or negative chars) advance like a space
+inline const FontGlyph& fontGlyph(char c) {
+    unsigned char code = (unsigned char)c;
+    return FONT_GLYPHS[code < 128 ? code : 0];
+}
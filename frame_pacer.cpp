@@ -0,0 +1,141 @@
+#include "frame_pacer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include "profiler.h"
+
+// Uyku payının sınırları => // Bounds of the spin margin
+static const uint64_t MIN_SPIN_MARGIN_NS = 200000;   // 0.2 ms
+static const uint64_t MAX_SPIN_MARGIN_NS = 4000000;  // 4 ms
+static const uint64_t START_SPIN_MARGIN_NS = 1000000; // 1 ms
+
+static const char* MODE_NAMES[(size_t)PacingMode::Count] = { "vsync", "adaptive", "limit", "uncapped" };
+
+const char* pacingModeName(PacingMode mode) {
+    return (size_t)mode < (size_t)PacingMode::Count ? MODE_NAMES[(size_t)mode] : "?";
+}
+
+bool parsePacingMode(const char* text, PacingMode& mode) {
+    for (size_t i = 0; i < (size_t)PacingMode::Count; i++) {
+        if (std::strcmp(text, MODE_NAMES[i]) == 0) {
+            mode = (PacingMode)i;
+            return true;
+        }
+    }
+    if (std::strcmp(text, "on") == 0) {
+        mode = PacingMode::Vsync;
+        return true;
+    }
+    if (std::strcmp(text, "off") == 0) {
+        mode = PacingMode::Uncapped;
+        return true;
+    }
+    return false;
+}
+
+FramePacer::FramePacer() : spinMarginNs(START_SPIN_MARGIN_NS) {
+    intervals.reserve(INTERVAL_HISTORY);
+    scratch.reserve(INTERVAL_HISTORY);
+}
+
+void FramePacer::setMode(PacingMode newMode) {
+    mode = newMode;
+    nextFrameNs = 0;
+    lastSwapNs = 0;
+    intervals.clear();
+    intervalPos = 0;
+}
+
+void FramePacer::setTargetFps(double fps) {
+    if (fps > 0.0) {
+        targetFps = fps;
+        nextFrameNs = 0;
+    }
+}
+
+int FramePacer::swapInterval() const {
+    switch (mode) {
+        case PacingMode::Vsync: return 1;
+        case PacingMode::AdaptiveVsync: return -1;
+        default: return 0;
+    }
+}
+
+void FramePacer::waitForNextFrame() {
+    if (mode != PacingMode::Limited) {
+        return;
+    }
+    const uint64_t period = (uint64_t)(1.0e9 / targetFps);
+    uint64_t now = Profiler::now();
+    // Bir kareden fazla geride kaldıysak yetişmek için art arda kare basma; buradan devam et
+    // If we are more than a frame behind, do not burst frames to catch up; continue from here
+    if (nextFrameNs == 0 || now > nextFrameNs + period) {
+        nextFrameNs = now;
+    }
+
+    if (nextFrameNs > now + spinMarginNs) {
+        uint64_t wakeAt = nextFrameNs - spinMarginNs;
+        std::this_thread::sleep_for(std::chrono::nanoseconds(wakeAt - now));
+        now = Profiler::now();
+        // Fazla uyuma payı aşarsa hemen büyüt, yoksa yavaşça küçült
+        // Grow the margin at once when the oversleep exceeds it, otherwise shrink it slowly
+        uint64_t oversleep = now > wakeAt ? now - wakeAt : 0;
+        if (oversleep + MIN_SPIN_MARGIN_NS > spinMarginNs) {
+            spinMarginNs = oversleep + MIN_SPIN_MARGIN_NS;
+        } else {
+            spinMarginNs -= (spinMarginNs - oversleep - MIN_SPIN_MARGIN_NS) / 16;
+        }
+        spinMarginNs = std::clamp(spinMarginNs, MIN_SPIN_MARGIN_NS, MAX_SPIN_MARGIN_NS);
+    }
+    // Kalan süre zamanlayıcı çözünürlüğünün altında; meşgul bekle
+    // The rest is below the timer resolution; busy-wait
+    while (now < nextFrameNs) {
+        std::this_thread::yield();
+        now = Profiler::now();
+    }
+    nextFrameNs += period;
+}
+
+void FramePacer::frameFinished(uint64_t nowNs) {
+    if (lastSwapNs != 0 && nowNs > lastSwapNs) {
+        float ms = (nowNs - lastSwapNs) / 1.0e6f;
+        if (intervals.size() < INTERVAL_HISTORY) {
+            intervals.push_back(ms);
+        } else {
+            intervals[intervalPos] = ms;
+        }
+        intervalPos = (intervalPos + 1) % INTERVAL_HISTORY;
+    }
+    lastSwapNs = nowNs;
+}
+
+FramePacingStats FramePacer::stats() const {
+    FramePacingStats result;
+    result.frames = intervals.size();
+    if (intervals.empty()) {
+        return result;
+    }
+    double sum = 0.0;
+    for (float ms : intervals) {
+        sum += ms;
+    }
+    result.meanMs = sum / intervals.size();
+    double variance = 0.0;
+    for (float ms : intervals) {
+        variance += (ms - result.meanMs) * (ms - result.meanMs);
+    }
+    result.jitterMs = std::sqrt(variance / intervals.size());
+
+    scratch.assign(intervals.begin(), intervals.end());
+    auto percentile = [this](float p) {
+        size_t k = std::min(scratch.size() - 1, (size_t)(p * (scratch.size() - 1) + 0.5f));
+        std::nth_element(scratch.begin(), scratch.begin() + k, scratch.end());
+        return (double)scratch[k];
+    };
+    result.p50Ms = percentile(0.5f);
+    result.p99Ms = percentile(0.99f);
+    result.maxMs = *std::max_element(intervals.begin(), intervals.end());
+    return result;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+// Kare temposu: vsync kipleri, uyu+bekle (sleep+spin) kare sınırlayıcı ve sınırsız kip.
+// Frame pacing: vsync modes, a sleep-plus-spin frame limiter and an uncapped mode.
+//
+// Simülasyon kendi iş parçacığında sabit 60 Hz'de ilerlediği için tempo oyun hızını
+// değiştirmez; yalnızca kaç kare çizildiğini (güç tüketimi) ve bir girdinin ekrana ne
+// kadar geç çıktığını (gecikme) belirler. Vsync kipleri yalnızca takas aralığını
+// seçer; sınırlayıcı hedef ana kadar uyur, son milisaniyeleri meşgul bekleyerek
+// geçirir. Uyku payı, işletim sisteminin ölçülen fazla uyumasına göre ayarlanır.
+// The simulation runs at a fixed 60 Hz on its own thread, so pacing does not change
+// game speed; it only decides how many frames are drawn (power) and how late an
+// input reaches the screen (latency). The vsync modes only choose the swap interval;
+// the limiter sleeps until close to the deadline and busy-waits the last part. The
+// spin margin adapts to how much the OS is measured to oversleep.
+//
+// GL bağımlılığı yoktur; takas aralığını çağıran uygular.
+// No GL dependency; the caller applies the swap interval.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class PacingMode {
+    Vsync,          // Takas aralığı 1 => // Swap interval 1
+    AdaptiveVsync,  // -1: geç kalan kare yırtılarak hemen basılır => // -1: a late frame is shown at once, with tearing
+    Limited,        // Vsync kapalı, hedef FPS'e sınırlı => // Vsync off, limited to the target FPS
+    Uncapped,       // Vsync kapalı, sınır yok (gerçek çizim verimi) => // Vsync off, no limit (true render throughput)
+    Count
+};
+
+const char* pacingModeName(PacingMode mode);
+// "vsync", "adaptive", "limit", "uncapped" (ve "on"/"off") => // (and "on"/"off")
+bool parsePacingMode(const char* text, PacingMode& mode);
+
+const double DEFAULT_TARGET_FPS = 60.0;
+
+// Son karelerin aralık istatistikleri (ms) => // Interval statistics over recent frames (ms)
+struct FramePacingStats {
+    size_t frames = 0;
+    double meanMs = 0.0;
+    double jitterMs = 0.0; // Standart sapma => // Standard deviation
+    double p50Ms = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+    double fps() const { return meanMs > 0.0 ? 1000.0 / meanMs : 0.0; }
+};
+
+class FramePacer {
+public:
+    static const size_t INTERVAL_HISTORY = 600; // Yaklaşık 10 s @ 60 FPS
+
+    FramePacer();
+
+    // Kipi değiştirir ve istatistikleri sıfırlar => // Changes the mode and resets the statistics
+    void setMode(PacingMode newMode);
+    void setTargetFps(double fps);
+    PacingMode getMode() const { return mode; }
+    double getTargetFps() const { return targetFps; }
+
+    // glfwSwapInterval için değer => // Value for glfwSwapInterval
+    int swapInterval() const;
+
+    // Limited kipinde bir sonraki kare zamanına kadar bekler; diğer kiplerde hemen döner
+    // In Limited mode waits until the next frame is due; returns at once in the other modes
+    void waitForNextFrame();
+
+    // Takas döndükten sonra çağrılır; iki takas arası kare aralığıdır
+    // Called after the swap returns; the time between two swaps is the frame interval
+    void frameFinished(uint64_t nowNs);
+
+    FramePacingStats stats() const;
+    // Sınırlayıcının şu anki meşgul bekleme payı (ms) => // The limiter's current spin margin (ms)
+    double spinMarginMs() const { return spinMarginNs / 1.0e6; }
+
+private:
+    PacingMode mode = PacingMode::Vsync;
+    double targetFps = DEFAULT_TARGET_FPS;
+
+    uint64_t nextFrameNs = 0;  // Sınırlayıcının hedef anı; 0 = henüz yok
+    uint64_t spinMarginNs;     // Uykudan bu kadar önce uyanıp beklenir
+    uint64_t lastSwapNs = 0;
+
+    std::vector<float> intervals; // Halka, ms => // Ring, ms
+    size_t intervalPos = 0;
+    mutable std::vector<float> scratch;
+};
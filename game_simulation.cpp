@@ -0,0 +1,819 @@
+#include "game_simulation.h"
+#include "trig_tables.h"
+#include "profiler.h"
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+GameSimulation::GameSimulation() {
+    blocks.reserve(MAX_BLOCKS + 1);
+    powerUps.reserve(MAX_POWERUPS + 1);
+    effects.reserve(16);
+    registerEffects();
+    soundEvents.reserve(16);
+    blockGrid.reserve(MAX_BLOCKS + 1);
+    powerUpGrid.reserve(MAX_POWERUPS + 1);
+    collisionCandidates.reserve(MAX_BLOCKS + MAX_POWERUPS + 2);
+    seed(0);
+}
+
+void GameSimulation::seed(uint64_t value) {
+    currentSeed = value;
+    gameplayRng.seed(value, 1);
+    spawnRng.seed(value, 2);
+    cosmeticRng.seed(value, 3);
+}
+
+void GameSimulation::start() {
+    gameStarted = true;
+    reset();
+    powerUps.clear();  // Tüm güç artırımlarını temizle
+    fadeInEffect = true;
+    fadeAlpha = 1.0f;
+}
+
+void GameSimulation::movePlayer(int direction) {
+    if (direction < 0 && playerX > -0.9f) playerX -= playerSpeed;
+    if (direction > 0 && playerX < 0.9f) playerX += playerSpeed;
+}
+
+void GameSimulation::applyInput(InputAction action) {
+    bool running = gameStarted && !gameOver;
+    switch (action) {
+        case InputAction::Start:
+            if (!running) {
+                start(); // Oyunu başlat veya yeniden başlat
+            }
+            break;
+        case InputAction::TogglePause:
+            if (running) {
+                isPaused = !isPaused;
+            }
+            break;
+        case InputAction::MoveLeft:
+            if (running && !isPaused) {
+                movePlayer(-1);
+            }
+            break;
+        case InputAction::MoveRight:
+            if (running && !isPaused) {
+                movePlayer(1);
+            }
+            break;
+        case InputAction::LeftDown:
+            heldKeys |= HELD_LEFT;
+            pressedKeys |= HELD_LEFT;
+            break;
+        case InputAction::LeftUp:
+            heldKeys &= (uint8_t)~HELD_LEFT;
+            break;
+        case InputAction::RightDown:
+            heldKeys |= HELD_RIGHT;
+            pressedKeys |= HELD_RIGHT;
+            break;
+        case InputAction::RightUp:
+            heldKeys &= (uint8_t)~HELD_RIGHT;
+            break;
+        case InputAction::ToggleMute:
+            break;
+    }
+}
+
+// Parçacık oluşturma fonksiyonu
+void GameSimulation::createParticle(float x, float y, float vx, float vy, 
+                   float r, float g, float b, float a,
+                   float lifetime, float size, float rotation, float rotationSpeed) {
+    particles.spawn(x, y, vx, vy, r, g, b, a, lifetime, size, rotation, rotationSpeed);
+}
+
+// Parçacıkları SIMD çekirdeğiyle güncelle; ölüler sonuncuyla yer değiştirilerek silinir
+// Update particles with the SIMD kernel; dead ones are removed by swap-with-last
+void GameSimulation::updateParticles(float deltaTime) {
+    particles.update(deltaTime, jobs);
+}
+
+// Çarpışma animasyonu için fonksiyon
+void GameSimulation::createBlockExplosion(float x, float y, float r, float g, float b) {
+    // Parçacık sayısı
+    const int numParticles = 20;
+    
+    // Tüm rastgele değerler tek seferde üretilir (parçacık başına 11)
+    // All random values are generated in one batch (11 per particle)
+    const int valuesPerParticle = 11;
+    float rnd[numParticles * valuesPerParticle];
+    cosmeticRng.fill(rnd, numParticles * valuesPerParticle);
+    
+    for (int i = 0; i < numParticles; i++) {
+        const float* u = rnd + i * valuesPerParticle;
+        
+        // Rastgele hız vektörü oluştur
+        const SinCos& dir = sinCosDegrees((int)(u[0] * 360.0f));
+        float speed = 0.1f + u[1] * 0.2f;
+        float vx = dir.c * speed;
+        float vy = dir.s * speed;
+        
+        // Parçacık boyutu
+        float size = 0.01f + u[2] * 0.05f;
+        
+        // Ömür
+        float lifetime = 0.5f + u[3] * 0.5f;
+        
+        // Renk varyasyonu ekle
+        float colorVar = 0.2f;
+        float rVal = r + (u[4] - 0.5f) * colorVar;
+        float gVal = g + (u[5] - 0.5f) * colorVar;
+        float bVal = b + (u[6] - 0.5f) * colorVar;
+        
+        // Değerleri sınırla
+        rVal = std::max(0.0f, std::min(1.0f, rVal));
+        gVal = std::max(0.0f, std::min(1.0f, gVal));
+        bVal = std::max(0.0f, std::min(1.0f, bVal));
+        
+        // Rastgele başlangıç pozisyonu (bloğun etrafında)
+        float startX = x + (u[7] - 0.5f) * 0.1f;
+        float startY = y + (u[8] - 0.5f) * 0.1f;
+        
+        // Parçacık oluştur
+        float rotation = u[9] * 360.0f;
+        float rotationSpeed = (u[10] - 0.5f) * 400.0f; // -200 ile 200 derece/san arası
+        
+        createParticle(startX, startY, vx, vy, rVal, gVal, bVal, 1.0f, lifetime, size, rotation, rotationSpeed);
+    }
+}
+
+// Level up efektini oluşturan fonksiyonu düzelt
+void GameSimulation::createLevelUpEffect() {
+    // Parçacık deposu sabit kapasiteli; dolduğunda eski parçacıklar tahliye edilir
+    // The particle store has fixed capacity; old particles are evicted when it fills up
+
+    // Parçacık sayısını sınırla
+    const int numRings = 2; // 3'ten 2'ye düşür
+    const int particlesPerRing = 20; // 30'dan 20'ye düşür
+    
+    for (int ring = 0; ring < numRings; ring++) {
+        float ringLifetime = 1.0f - ring * 0.2f;
+        
+        for (int i = 0; i < particlesPerRing; i++) {
+            const SinCos& dir = UNIT_CIRCLE<particlesPerRing>[i];
+            
+            // Parçacıklar dairesel harekette dışa doğru hareket eder
+            float vx = dir.c * 0.2f;
+            float vy = dir.s * 0.2f;
+            
+            // Halkadaki başlangıç pozisyonu
+            float x = dir.c * (0.05f + ring * 0.05f); // Merkeze yakın başla
+            float y = dir.s * (0.05f + ring * 0.05f);
+            
+            // Altın-sarı parçacıklar
+            float r = 1.0f;
+            float g = 0.9f - ring * 0.2f;
+            float b = 0.4f - ring * 0.1f;
+            
+            createParticle(x, y, vx, vy, r, g, b, 0.8f, ringLifetime, 0.03f, i * 360.0f / particlesPerRing, 60.0f);
+        }
+    }
+    
+    // Beyaz parıltıları sınırla
+    const int maxSparkles = 20; // 50'den 20'ye düşür
+    const int valuesPerSparkle = 6;
+    float rnd[maxSparkles * valuesPerSparkle];
+    cosmeticRng.fill(rnd, maxSparkles * valuesPerSparkle);
+    
+    for (int i = 0; i < maxSparkles; i++) {
+        const float* u = rnd + i * valuesPerSparkle;
+        const SinCos& dir = sinCosDegrees((int)(u[0] * 360.0f));
+        float dist = u[1] * 0.5f; // 0 ile 0.5 arası
+        
+        float x = dir.c * dist;
+        float y = dir.s * dist;
+        
+        // Merkezden dışa doğru hız vektörü
+        float speed = 0.05f + u[2] * 0.2f;
+        float vx = dir.c * speed;
+        float vy = dir.s * speed;
+        
+        float size = 0.01f + u[3] * 0.05f;
+        float lifetime = 0.5f + u[4] * 0.5f;
+        
+        // Beyaz parıltı
+        float whiteness = 0.8f + u[5] * 0.2f; // 0.8 ile 1.0 arası
+        createParticle(x, y, vx, vy, whiteness, whiteness, whiteness, 0.9f, lifetime, size);
+    }
+}
+
+// Ekstra can toplama efekti
+void GameSimulation::createHeartEffect(float x, float y) {
+    // Kalp şeklinde parçacıklar oluştur
+    const int numParticles = 20;
+    const int valuesPerParticle = 6;
+    float rnd[numParticles * valuesPerParticle];
+    cosmeticRng.fill(rnd, numParticles * valuesPerParticle);
+    
+    for (int i = 0; i < numParticles; i++) {
+        const float* u = rnd + i * valuesPerParticle;
+        const SinCos& dir = sinCosDegrees((int)(u[0] * 360.0f));
+        float speed = 0.05f + u[1] * 0.1f;
+        float vx = dir.c * speed;
+        float vy = dir.s * speed + 0.01f; // Hafif yukarı yönelim
+        
+        float size = 0.01f + u[2] * 0.02f;
+        float lifetime = 1.0f + u[3] * 0.5f;
+        
+        // Kalp şeklindeki parçacıklar kırmızı/pembe
+        createParticle(x, y, vx, vy, 1.0f, 0.2f + u[4] * 0.5f, 0.4f, 
+                      1.0f, lifetime, size, 0, (u[5] - 0.5f) * 200.0f);
+    }
+}
+
+// Kalkan kırılma efekti
+void GameSimulation::createShieldBreakEffect(float x, float y) {
+    const int numParticles = 30;
+    const float radius = 0.15f;
+    const int valuesPerParticle = 3;
+    float rnd[numParticles * valuesPerParticle];
+    cosmeticRng.fill(rnd, numParticles * valuesPerParticle);
+    
+    for (int i = 0; i < numParticles; i++) {
+        const float* u = rnd + i * valuesPerParticle;
+        const SinCos& dir = UNIT_CIRCLE<numParticles>[i];
+        
+        // Parçacıklar kalkan yarıçapında başlar
+        float startX = x + dir.c * radius;
+        float startY = y + dir.s * radius;
+        
+        // Dışa doğru hız
+        float speed = 0.1f + u[0] * 0.2f;
+        float vx = dir.c * speed;
+        float vy = dir.s * speed;
+        
+        // Kalkan parçacıkları mavi/camgöbeği
+        createParticle(startX, startY, vx, vy, 0.3f, 0.8f, 1.0f, 
+                      0.8f, 0.5f, 0.02f, u[1] * 360.0f, (u[2] - 0.5f) * 400.0f);
+    }
+}
+
+// Büyük patlama efekti
+void GameSimulation::createMassiveExplosion(float x, float y, float radius) {
+    // Üç aşamanın tüm rastgele değerleri tek seferde üretilir
+    // Random values for all three stages are generated in one batch
+    const int numFlash = 50, numDebris = 100, numSmoke = 40;
+    const int flashValues = 3, debrisValues = 7, smokeValues = 7;
+    float rnd[numFlash * flashValues + numDebris * debrisValues + numSmoke * smokeValues];
+    cosmeticRng.fill(rnd, sizeof(rnd) / sizeof(rnd[0]));
+    const float* u = rnd;
+    
+    // Önce parlak bir flaş oluştur
+    for (int i = 0; i < numFlash; i++, u += flashValues) {
+        const SinCos& dir = sinCosDegrees((int)(u[0] * 360.0f));
+        float distance = u[1] * radius;
+        float startX = x + dir.c * distance;
+        float startY = y + dir.s * distance;
+        
+        // Flaş parçacıkları - parlak beyaz/sarı ve kısa ömürlü
+        createParticle(startX, startY, 0, 0, 1.0f, 1.0f, 0.8f, 
+                      0.9f, 0.2f, 0.05f + u[2] * 0.1f);
+    }
+    
+    // Sonra patlama molozları oluştur
+    for (int i = 0; i < numDebris; i++, u += debrisValues) {
+        const SinCos& dir = sinCosDegrees((int)(u[0] * 360.0f));
+        float speed = 0.1f + u[1] * 0.4f;
+        float vx = dir.c * speed;
+        float vy = dir.s * speed;
+        
+        // Patlama parçacıkları - kırmızı/turuncu ve daha uzun ömürlü
+        float r = 0.8f + u[2] * 0.2f;
+        float g = 0.3f + u[3] * 0.4f;
+        float b = 0.0f;
+        
+        createParticle(x, y, vx, vy, r, g, b, 
+                      1.0f, 1.0f, 0.02f + u[4] * 0.05f, 
+                      u[5] * 360.0f, (u[6] - 0.5f) * 400.0f);
+    }
+    
+    // Kalıcı duman parçacıkları ekle
+    for (int i = 0; i < numSmoke; i++, u += smokeValues) {
+        const SinCos& dir = sinCosDegrees((int)(u[0] * 360.0f));
+        float speed = 0.03f + u[1] * 0.05f;
+        float vx = dir.c * speed;
+        float vy = dir.s * speed + 0.01f; // Hafif yukarı yönelim
+        
+        float gray = 0.2f + u[2] * 0.6f;
+        
+        // Daha büyük, daha yavaş duman parçacıkları oluştur
+        createParticle(x, y, vx, vy, gray, gray, gray, 
+                      0.7f, 2.0f + u[3], 
+                      0.04f + u[4] * 0.1f, 
+                      u[5] * 360.0f, (u[6] - 0.5f) * 100.0f);
+    }
+}
+
+// resetGame() fonksiyonunda seviyeye dayalı blok hareket desenleri ayarla
+void GameSimulation::reset() {
+    playerX = 0.0f;
+    score = 0;
+    health = 3;
+    level = 1;
+    blockSpeed = 0.01f;
+    gameOver = false;
+    blocks.clear();
+    powerUps.clear();  
+    effects.clear();
+    playerSpeed = originalPlayerSpeed;
+    backgroundColor = 0.0f;
+    colorIncreasing = true;
+    timeSlowFactor = 1.0f;
+    
+    // Parçacıkları temizle
+    particles.clear();
+
+    // resetGame() içinde seviye tabanlı hareket deseni atamasıyla bloklar oluştur
+    for (int i = 0; i < 3; i++) {
+        float r = 0.7f + cosmeticRng.uniform() * 0.3f; // Ağırlıklı kırmızı renk
+        float g = 0.0f + cosmeticRng.uniform() * 0.3f; 
+        float b = 0.0f + cosmeticRng.uniform() * 0.3f;
+        
+        float xPos = spawnRng.range(-100, 100) / 100.0f;
+        
+        // Seviye 3'ten önce sadece doğrusal hareket (0)
+        int movementPattern = 0; // Başlangıçta her zaman doğrusal
+        int shape = spawnRng.range(3); // şekil (0, 1 veya 2)
+
+        addBlock(xPos, 1.0f, shape, r, g, b, movementPattern, xPos);
+    }
+
+    if (logEvents) {
+        std::cout << "Oyun Sıfırlandı! Yeni oyun başladı!" << std::endl;
+    }
+}
+
+size_t GameSimulation::addBlock(float x, float y, int shape, float r, float g, float b, int pattern, float originX) {
+    return blocks.add({x, y}, {x, y}, {0.0f, -1.0f}, {shape}, {r, g, b}, {pattern, 0.0f, originX});
+}
+
+size_t GameSimulation::addPowerUp(float x, float y, int type) {
+    return powerUps.add({x, y}, {x, y}, {0.0f, -1.0f}, {type});
+}
+
+// Fix the block movement function to prevent potential out-of-bounds issues
+void GameSimulation::updateBlockMovement(size_t row) {
+    Position& position = blocks.at<Position>(row);
+    Movement& movement = blocks.at<Movement>(row);
+
+    // Level 3'e özel güvenlik kontrolü => // Special security check for Level 3
+    if (level == 3 && movement.pattern != 0) {
+        // Level 3'te tüm blokları doğrusal hareket ettir => // Make all blocks move linearly in Level 3
+        movement.pattern = 0;
+    }
+
+    try {
+        // Update position based on movement pattern
+        switch (movement.pattern) {
+            case 0: // Linear - just move down
+                // y position is updated in the main loop
+                break;
+                
+            case 1: // Zigzag - horizontal sine wave (daha az agresif) => // Zigzag - horizontal sine wave (less aggressive) 
+                // Make sure the block doesn't go off screen
+                position.x = movement.originX + sin(movement.timer * 2.0f) * 0.2f; // Daha az genlik => // Less amplitude
+                // Clamp to screen boundaries
+                if (position.x < -0.95f) position.x = -0.95f;
+                if (position.x > 0.95f) position.x = 0.95f;
+                movement.timer += 0.01f; // Daha yavaş => // Slower
+                break;
+                
+            case 2: // Circular - orbit around a center point
+                // Circular hareketi devre dışı bırak - hata kaynağı olabilir => // Disable circular movement - could be source of errors
+                movement.pattern = 1;
+                position.x = movement.originX + sin(movement.timer * 2.0f) * 0.15f;
+                movement.timer += 0.01f;
+                break;
+                
+            default:
+                // Geçersiz bir hareket paterni için güvenli davranış => // Safe behavior for invalid movement pattern
+                movement.pattern = 0;
+                break;
+        }
+    }
+    catch (...) {
+        // Herhangi bir hata durumunda güvenli değerler ayarla => // Set safe values in case of any error
+        movement.pattern = 0; // Doğrusal harekete zorla => // Force linear movement
+    }
+}
+
+// Düşen ya da çarpışan bloğu ekranın üstüne yeni şekil/renk/desenle geri gönder
+// Send a fallen or collided block back to the top with a new shape, color and pattern
+void GameSimulation::respawnBlock(size_t row) {
+    Position& position = blocks.at<Position>(row);
+    Movement& movement = blocks.at<Movement>(row);
+    Color& color = blocks.at<Color>(row);
+
+    float xPos = spawnRng.range(-100, 100) / 100.0f;
+    position.x = xPos;
+    position.y = 1.0f;
+    movement.originX = xPos; // Set new origin X
+    // Işınlanan blok interpolasyonla ekran boyunca kaymasın => // Teleported block must not be interpolated across the screen
+    blocks.at<PrevPosition>(row) = {position.x, position.y};
+    // Assign new shape, color and movement pattern
+    blocks.at<BlockShape>(row).kind = spawnRng.range(3);
+    color.r = 0.7f + cosmeticRng.uniform() * 0.3f;
+    color.g = 0.0f + cosmeticRng.uniform() * 0.3f;
+    color.b = 0.0f + cosmeticRng.uniform() * 0.3f;
+
+    // Only linear movement (0) until level 3
+    movement.pattern = (level < 3) ? 0 : spawnRng.range(3);
+    movement.timer = 0.0f;
+}
+
+// Geniş faz: power-up merkezlerini ızgaraya koy, sadece oyuncuya yakın olanları test et
+// Broadphase: bucket power-up centres, only test the ones near the player
+void GameSimulation::findPowerUpCollisions() {
+    powerUpGrid.clear();
+    const std::vector<Position>& positions = powerUps.get<Position>();
+    for (size_t i = 0; i < powerUps.size(); i++) {
+        powerUpGrid.insert((uint32_t)i, positions[i].x + 0.04f, positions[i].y - 0.04f);
+    }
+    powerUpGrid.build();
+
+    collisionCandidates.clear();
+    powerUpGrid.queryRadius(playerX + 0.05f, -0.85f, 0.12f, [&](uint32_t id, float, float) {
+        collisionCandidates.push_back(id);
+    });
+    // Hücre sırasından bağımsız, dizideki sırayla uygula => // Apply in array order, independent of cell order
+    std::sort(collisionCandidates.begin(), collisionCandidates.end());
+}
+
+// Geniş faz: blok merkezlerini ızgaraya koy; çarpışma sadece oyuncunun yakınındaki bloklar için test edilir.
+// Izgara adım boyunca geçerlidir, blok-blok ve parçacık-blok sorguları için de kullanılabilir.
+// Broadphase: bucket block centres; only blocks near the player get a narrowphase test.
+// The grid stays valid for the rest of the step and also serves block-vs-block and particle-vs-block queries.
+void GameSimulation::findBlockCollisions() {
+    blockGrid.clear();
+    const std::vector<Position>& positions = blocks.get<Position>();
+    for (size_t i = 0; i < blocks.size(); i++) {
+        blockGrid.insert((uint32_t)i, positions[i].x + 0.05f, positions[i].y - 0.05f);
+    }
+    blockGrid.build();
+
+    collisionCandidates.clear();
+    blockGrid.queryRadius(playerX + 0.05f, -0.85f, 0.1f, [&](uint32_t id, float, float) {
+        collisionCandidates.push_back(id);
+    });
+    std::sort(collisionCandidates.begin(), collisionCandidates.end());
+}
+
+void GameSimulation::registerEffects() {
+    // Kayıt sırası TimedEffect değerleriyle aynı olmalı => // Registration order must match the TimedEffect values
+    effects.addType(EffectStacking::Refresh,
+        [this](uint32_t) { playerSpeed = originalPlayerSpeed + 0.1f; },
+        [this](uint32_t) { playerSpeed = originalPlayerSpeed; });
+
+    effects.addType(EffectStacking::Refresh,
+        [this](uint32_t) {
+            blocks.clear();
+            // Yeni bir blok ekle => // Add a new block
+            float xPos = spawnRng.range(-90, 90) / 100.0f;
+            float originX = spawnRng.range(-90, 90) / 100.0f;
+            addBlock(xPos, 1.0f, 0, 0.7f, 0.0f, 0.0f, 0, originX);
+        },
+        [this](uint32_t) {
+            // Restore normal block generation - doğru bir şekilde blokları oluştur => // Restore normal block generation - create blocks properly
+            blocks.clear(); // İlk önce tüm blokları temizle => // First clear all blocks
+            for (int i = 0; i < level && i < MAX_BLOCKS; i++) {
+                float r = 0.7f + cosmeticRng.uniform() * 0.3f;
+                float g = 0.0f + cosmeticRng.uniform() * 0.3f;
+                float b = 0.0f + cosmeticRng.uniform() * 0.3f;
+
+                float xPos = spawnRng.range(-100, 100) / 100.0f;
+                float yPos = 1.0f + (i * 0.3f); // yeni blokların üst üste gelmesini önlemek için aralık bırakın => // leave spacing to prevent new blocks from stacking
+                int shape = spawnRng.range(3);
+                int pattern = (level < 3) ? 0 : spawnRng.range(3);
+
+                addBlock(xPos, yPos, shape, r, g, b, pattern, xPos);
+            }
+        });
+
+    effects.addType(EffectStacking::Refresh); // Invisibility
+
+    effects.addType(EffectStacking::Refresh,
+        [this](uint32_t) { timeSlowFactor = 0.5f; },
+        [this](uint32_t) { timeSlowFactor = 1.0f; });
+
+    effects.addType(EffectStacking::Refresh); // Shield
+}
+
+// Toplanan power-up'ın etkisini uygula => // Apply the effect of a collected power-up
+void GameSimulation::applyPowerUp(int type) {
+    switch (type) {
+        case 1: // Speed
+            startEffect(TimedEffect::SpeedBoost, 20.0f);
+            break;
+
+        case 2: // Block Reset
+            startEffect(TimedEffect::BlockReset, 20.0f);
+            break;
+
+        case 3: // Invisibility
+            startEffect(TimedEffect::Invisibility, 20.0f);
+            break;
+
+        case 4: // Time Slow
+            startEffect(TimedEffect::TimeSlow, 15.0f);
+            break;
+
+        case 5: // Shield
+            startEffect(TimedEffect::Shield, 10.0f);
+            break;
+
+        case 6: // Extra Life
+            health++;
+            // Sadece kısıtlı sayıda parçacıklar ekle => // Add only a limited number of particles
+            for (int i = 0; i < 5; i++) {
+                const SinCos& dir = sinCosDegrees(cosmeticRng.range(360));
+                createParticle(playerX + 0.05f, -0.8f,
+                             dir.c*0.05f, dir.s*0.05f,
+                             1.0f, 0.2f, 0.4f,
+                             1.0f, 0.5f, 0.02f);
+            }
+            break;
+    }
+}
+
+// Oyunu tek bir sabit adım (dt) ilerlet - çizim yok => // Advance the game by one fixed step (dt) - no drawing
+void GameSimulation::step(float dt) {
+    steps++;
+    previousPlayerX = playerX;
+    // Basış mandalı her adımda tüketilir; duraklatılmışken yapılan basışlar birikmez
+    // The press latch is consumed every step; presses made while paused do not pile up
+    const uint8_t pressed = pressedKeys;
+    pressedKeys = 0;
+    // Aşama süreleri: her next() bir aşamayı kapatıp diğerini açar => // Stage timing: each next() closes one stage and opens another
+    ProfileScope stage(profiler, ProfileStage::Fades);
+
+    // Main loop başlangıcında vektörleri kontrol et ve sınırla => // Check and limit vectors at the beginning of each step
+    blocks.truncate(MAX_BLOCKS);
+    powerUps.truncate(MAX_POWERUPS);
+
+    // Background color animation
+    if (colorIncreasing) {
+        backgroundColor += 0.001f;
+    } else {
+        backgroundColor -= 0.001f;
+    }
+
+    if (backgroundColor >= 1.0f) {
+        colorIncreasing = false;
+    }
+    if (backgroundColor <= 0.0f) {
+        colorIncreasing = true;
+    }
+
+    // Handle fade effects
+    if (fadeInEffect) {
+        fadeAlpha -= 0.01f;
+        if (fadeAlpha <= 0.0f) {
+            fadeAlpha = 0.0f;
+            fadeInEffect = false;
+        }
+    }
+
+    if (fadeOutEffect) {
+        fadeAlpha += 0.01f;
+        if (fadeAlpha >= 1.0f) {
+            fadeAlpha = 1.0f;
+            fadeOutEffect = false;
+        }
+    }
+
+    // Sadece aktif oyunda simülasyon çalışır => // Gameplay only advances while actively playing
+    if (!gameStarted || gameOver || isPaused) {
+        return;
+    }
+
+    stage.next(ProfileStage::PowerUps);
+
+    // Basılı ya da bu adımda basılmış tuşlar örneklenir; iki yön birden birbirini götürür
+    // Keys held or pressed for this step are sampled; both directions at once cancel out
+    const uint8_t moving = heldKeys | pressed;
+    if (moving == HELD_LEFT && playerX > -0.9f) {
+        playerX -= (pressed & HELD_LEFT) ? playerSpeed : playerSpeed * HELD_MOVE_SCALE;
+    } else if (moving == HELD_RIGHT && playerX < 0.9f) {
+        playerX += (pressed & HELD_RIGHT) ? playerSpeed : playerSpeed * HELD_MOVE_SCALE;
+    }
+
+    // Interpolasyon için önceki pozisyonları sakla => // Store previous positions for interpolation
+    blocks.each<Position, PrevPosition>([](const Position& position, PrevPosition& previous) {
+        previous = {position.x, position.y};
+    });
+    powerUps.each<Position, PrevPosition>([](const Position& position, PrevPosition& previous) {
+        previous = {position.x, position.y};
+    });
+
+    // PowerUp oluşturma kodu - seviye bazlı ihtimal artışı => // PowerUp creation code - level-based probability increase
+    // Seviyeye bağlı olarak düşme ihtimalini belirle => // Determine drop probability based on level
+    int powerUpChance;
+    if (level <= 3) {
+        powerUpChance = 500; // 1/500 ihtimal (seviye 3 ve öncesi)
+    } else if (level <= 5) {
+        powerUpChance = 300; // 1/300 ihtimal (seviye 4-5)
+    } else if (level <= 8) {
+        powerUpChance = 200; // 1/200 ihtimal (seviye 6-8)
+    } else {
+        powerUpChance = 100; // 1/100 ihtimal (seviye 9+)
+    }
+
+    // Power-up oluştur => // Create power-up
+    if (gameplayRng.range(powerUpChance) == 0 && powerUps.size() < MAX_POWERUPS) { // Power-up sayısını sınırlama ekle
+        // Power-up türü dağılımını seviyeye göre ayarla => // Adjust power-up type distribution based on level
+        int powerUpType;
+        int r = gameplayRng.range(100);
+
+        if (level <= 3) {
+            // Temel power-up'lar daha yaygın (1-3) => // Basic power-ups more common (1-3)
+            powerUpType = (r < 80) ? (gameplayRng.range(3) + 1) : (gameplayRng.range(3) + 4);
+        } else if (level <= 6) {
+            // Dağılım biraz daha dengeli => // Distribution is more balanced
+            powerUpType = (r < 60) ? (gameplayRng.range(3) + 1) : (gameplayRng.range(3) + 4);
+        } else {
+            // Gelişmiş power-up'lar daha yaygın (4-6) => // Advanced power-ups more common (4-6)
+            powerUpType = (r < 40) ? (gameplayRng.range(3) + 1) : (gameplayRng.range(3) + 4);
+        }
+
+        float xPos = spawnRng.range(-100, 100) / 100.0f;
+        addPowerUp(xPos, 1.0f, powerUpType);
+    }
+
+    // PowerUp hareketi => // Move power-ups
+    // Düşüş hızı: hız bileşeni dünya düşüş hızıyla ölçeklenir => // Fall speed: velocity is scaled by the world fall speed
+    const float fallSpeed = blockSpeed * (hasEffect(TimedEffect::TimeSlow) ? timeSlowFactor : 1.0f);
+    powerUps.each<Position, Velocity>([fallSpeed](Position& position, const Velocity& velocity) {
+        position.x += velocity.x * fallSpeed;
+        position.y += velocity.y * fallSpeed;
+    });
+
+    findPowerUpCollisions();
+
+    for (uint32_t index : collisionCandidates) {
+        soundEvents.push_back(SoundEvent::PowerUp);
+        try {
+            applyPowerUp(powerUps.at<PowerUpKind>(index).type);
+        }
+        catch (...) {
+            std::cerr << "Error processing powerup" << std::endl;
+        }
+    }
+
+    // Toplanan ve ekrandan çıkan power-up'ları sil => // Remove collected and off-screen power-ups
+    size_t nextCollected = 0;
+    powerUps.retain([&](size_t row) {
+        bool collected = nextCollected < collisionCandidates.size() && collisionCandidates[nextCollected] == row;
+        if (collected) {
+            nextCollected++;
+            return false;
+        }
+        const Position& position = powerUps.at<Position>(row);
+        return !(position.y < -1.0f || position.y > 1.5f || position.x < -1.5f || position.x > 1.5f);
+    });
+
+    // Update power-up timers
+    effects.tick();
+
+    stage.next(ProfileStage::Blocks);
+
+    // Update blocks
+    // Seviye atlama blok ekleyip silebilir, bu yüzden indeksle gez => // Level-up may add or drop blocks, so iterate by index
+    // Düşüş, desen ve yeniden doğma satır satır iç içe kalır: düşen her blok blockSpeed'i
+    // artırır (sonraki satırlar yeni hızla düşer), seviye atlama blok ekler/siler ve
+    // RNG sırası replay'ler için korunmalıdır
+    // Fall, pattern and respawn stay interleaved per row: every fallen block raises
+    // blockSpeed (later rows fall at the new speed), a level-up adds or drops blocks,
+    // and the RNG order must be preserved for replays
+    const float fallScale = hasEffect(TimedEffect::TimeSlow) ? timeSlowFactor : 1.0f;
+    for (size_t blockIndex = 0; blockIndex < blocks.size(); blockIndex++) {
+        // Update block's position (common for all blocks)
+        const float blockFallSpeed = blockSpeed * fallScale;
+        Position& position = blocks.at<Position>(blockIndex);
+        const Velocity& velocity = blocks.at<Velocity>(blockIndex);
+        position.x += velocity.x * blockFallSpeed;
+        position.y += velocity.y * blockFallSpeed;
+
+        // Update block's movement based on pattern
+        updateBlockMovement(blockIndex);
+
+        // Code at the end of block's fall (block.y < -1.0f condition)
+        if (blocks.at<Position>(blockIndex).y < -1.0f) {
+            respawnBlock(blockIndex);
+
+            // Blok düşüşü sonrası puan güncellemesi => // Score update after block drop
+            if (!gameOver) {
+                score++;
+
+                // Level up kodunu daha da güvenceye al => // Make level up code even more secure
+                if (score > 0 && score % SCORE_PER_LEVEL == 0) {
+                    try {
+                        if (logEvents) {
+                            std::cout << "Level up! Score: " << score << ", New level: " << level + 1 << std::endl;
+                        }
+                        level++;
+                        blockSpeed += LEVEL_SPEED_INCREASE;
+
+                        // Level up sound güvenli bir şekilde çal => // Play level up sound safely
+                        soundEvents.push_back(SoundEvent::LevelUp);
+
+                        // Parçacık efekti yaratmayı basitleştir ve sınırla => // Simplify and limit particle effect creation
+                        float centerX = 0.0f;
+                        float centerY = 0.0f;
+
+                        // Sadece 5 basit parçacık yarat => // Create only 5 simple particles
+                        for (int i = 0; i < 5; i++) {
+                            const SinCos& dir = UNIT_CIRCLE<5>[i];
+                            float vx = dir.c * 0.1f;
+                            float vy = dir.s * 0.1f;
+
+                            // Basit sarı parçacıklar => // Simple yellow particles
+                            createParticle(centerX, centerY, vx, vy,
+                                          1.0f, 1.0f, 0.0f, // yellow
+                                          1.0f, 0.5f, 0.03f); // alpha, lifetime, size
+                        }
+
+                        // Yeni blok ekleme - eğer level 3'e geçiyorsak dikkatli olalım => // Add new block - be careful if transitioning to level 3
+                        if (level == 3) {
+                            // Level 3'e geçişte özel güvenlik kontrolü => // Special security check when transitioning to level 3
+                            if (logEvents) {
+                                std::cout << "Transitioning to level 3 (special handling)" << std::endl;
+                            }
+
+                            // Mevcut blokları güvenceye al - çok fazla blok varsa sil => // Secure existing blocks - delete if there are too many
+                            if (blocks.size() > MAX_BLOCKS / 2) {
+                                blocks.truncate(MAX_BLOCKS / 2);
+                            }
+
+                            // Sadece bir adet basit blok ekle => // Add just one simple block
+                            float xPos = 0.0f; // Merkeze yakın güvenli bir pozisyon => // Safe position near center
+                            // Kare, kırmızı, doğrusal (en basit) => // Square, red, linear (simplest)
+                            addBlock(xPos, 1.0f, 0, 1.0f, 0.0f, 0.0f, 0, xPos);
+                        }
+                        // Diğer levellar için normal blok eklemeyi kullan => // Use normal block addition for other levels
+                        else if (blocks.size() < MAX_BLOCKS) {
+                            float xPos = spawnRng.range(-90, 90) / 100.0f;
+                            int pattern = (level < 3) ? 0 : spawnRng.range(2); // Bazı hareket çeşitlerini sınırla => // Limit some movement types
+                            addBlock(xPos, 1.0f, 0, 0.7f, 0.0f, 0.0f, pattern, xPos);
+                        }
+                    }
+                    catch (const std::exception& e) {
+                        std::cerr << "CRITICAL - Level up exception: " << e.what() << std::endl;
+                        // Kritik hata - minimum güvenlik önlemleri => // Critical error - minimum security measures
+                        level++; // Yine de level'ı artır => // Still increase the level
+                    }
+                    catch (...) {
+                        std::cerr << "CRITICAL - Unknown level up exception" << std::endl;
+                        level++; // Yine de level'ı artır => // Still increase the level
+                    }
+                } else {
+                    blockSpeed += NORMAL_SPEED_INCREASE;
+                }
+            }
+        }
+    }
+
+    stage.next(ProfileStage::Collision);
+
+    findBlockCollisions();
+
+    // When resetting block after collision
+    for (uint32_t index : collisionCandidates) {
+        if (!hasEffect(TimedEffect::Invisibility)) {
+            // Check if shield is active
+            if (hasEffect(TimedEffect::Shield)) {
+                // Just disable shield instead of taking damage
+                cancelEffect(TimedEffect::Shield);
+                // Shield breaking effect
+                createShieldBreakEffect(playerX + 0.05f, -0.85f);
+            } else {
+                // No shield, take damage
+                health--;
+                soundEvents.push_back(SoundEvent::Collision);
+
+                // Add collision animation
+                const Position& position = blocks.at<Position>(index);
+                const Color& color = blocks.at<Color>(index);
+                createBlockExplosion(position.x + 0.05f, position.y - 0.05f, color.r, color.g, color.b);
+
+                if (health <= 0) {
+                    soundEvents.push_back(SoundEvent::GameOver);
+                    gameOver = true;
+                    fadeOutEffect = true;
+                    fadeAlpha = 0.0f;
+                }
+            }
+        }
+
+        // Reset block position regardless of invisibility or shield
+        respawnBlock(index);
+    }
+
+    // Update particles
+    stage.next(ProfileStage::Particles);
+    updateParticles(dt);
+}
@@ -0,0 +1,229 @@
+#pragma once
+
+// Oyun mantığı - grafik (GL) ve ses (SFML) bağımlılığı yoktur.
+// Gameplay logic - no graphics (GL) or audio (SFML) dependencies.
+// Pencereli oyun ve --headless modu aynı simülasyonu çalıştırır.
+// The windowed game and the --headless mode run the same simulation.
+
+#include <vector>
+#include <cstdint>
+#include "particle_system.h"
+#include "spatial_grid.h"
+#include "rng.h"
+#include "ecs.h"
+#include "effect_scheduler.h"
+
+const int SCORE_PER_LEVEL = 20; // Seviye atlamak için gereken puan
+const float LEVEL_SPEED_INCREASE = 0.0003f; // Seviye başına hız artışı
+const float NORMAL_SPEED_INCREASE = 0.00003f; // Puan başına küçük hız artışı
+const int MAX_BLOCKS = 10; // Maksimum blok sayısı
+const int MAX_POWERUPS = 10; // Ekrandaki maksimum power-up sayısı
+const int MAX_PARTICLES = 262144; // Varsayılan parçacık kapasitesi (--particles ile değiştirilebilir)
+
+// Sabit adımlı simülasyon saati => // Fixed-step simulation clock
+// Tüm oyun mantığı 60 Hz'lik sabit adımlarla ilerler; çizim hızı bundan bağımsızdır.
+// All gameplay advances in fixed 60 Hz steps; the render rate is independent of it.
+const float SIM_DT = 1.0f / 60.0f;
+
+// Basılı tutulan yön tuşunda adım başına hareket, playerSpeed'in kesri olarak.
+// Basışın ilk adımı tam playerSpeed ilerler; kısa bir dokunuş eskisi kadar hareket eder.
+// Movement per step while a direction key is held, as a fraction of playerSpeed.
+// The first step of a press moves a full playerSpeed, so a short tap moves as far as before.
+const float HELD_MOVE_SCALE = 0.4f;
+
+// Oyuna özgü bileşenler => // Gameplay components
+struct BlockShape {
+    int kind; // 0 = kare, 1 = üçgen, 2 = daire
+};
+
+struct Movement {
+    int pattern;   // 0 = doğrusal, 1 = zigzag, 2 = dairesel
+    float timer;   // Hareket döngülerini takip için
+    float originX; // Dairesel/zigzag desenler için orijinal X pozisyonu
+};
+
+struct PowerUpKind {
+    int type; // 1 = hız, 2 = blok sıfırlama, 3 = görünmezlik, 4 = zaman yavaşlatma, 5 = kalkan, 6 = ekstra can
+};
+
+// Süreli güç-artırma etkileri; değerler EffectScheduler tür kimlikleridir (bu sırayla kaydedilir)
+// Timed power-up effects; the values are EffectScheduler type ids (registered in this order)
+enum class TimedEffect : uint8_t {
+    SpeedBoost,
+    BlockReset,
+    Invisibility,
+    TimeSlow,
+    Shield
+};
+
+// Arketipler => // Archetypes
+using BlockArchetype = Archetype<Position, PrevPosition, Velocity, BlockShape, Color, Movement>;
+using PowerUpArchetype = Archetype<Position, PrevPosition, Velocity, PowerUpKind>;
+
+// Simülasyonun çalınmasını istediği sesler; ön yüz bunları her karede tüketir
+// Sounds the simulation wants played; the front end drains them every frame
+enum class SoundEvent {
+    Collision,
+    PowerUp,
+    LevelUp,
+    GameOver
+};
+
+// Oyuncu girdileri; pencereli modda tuşlardan, replay modunda dosyadan gelir ve
+// her zaman bir adım sınırında uygulanır (replay'in birebir tekrarı için)
+// Player inputs; they come from keys in windowed mode or from a file in replay
+// mode, and are always applied at a step boundary (so replays are bit-exact)
+enum class InputAction : uint8_t {
+    Start = 1,       // ENTER
+    TogglePause = 2, // P
+    ToggleMute = 3,  // M (yalnızca ön yüz; simülasyonu etkilemez)
+    MoveLeft = 4,    // Tek seferlik adım (eski kayıtlar ve headless) => // One-off step (old recordings and headless)
+    MoveRight = 5,
+    LeftDown = 6,    // LEFT basıldı; bırakılana kadar her adım hareket => // LEFT pressed; moves every step until released
+    LeftUp = 7,
+    RightDown = 8,   // RIGHT
+    RightUp = 9
+};
+
+// Basılı yön tuşları (heldKeys bitleri) => // Held direction keys (heldKeys bits)
+const uint8_t HELD_LEFT = 1u << 0;
+const uint8_t HELD_RIGHT = 1u << 1;
+
+class Profiler;
+class JobSystem;
+
+class GameSimulation {
+public:
+    GameSimulation();
+
+    // Etki geri çağrıları this'i yakalar => // Effect callbacks capture this
+    GameSimulation(const GameSimulation&) = delete;
+    GameSimulation& operator=(const GameSimulation&) = delete;
+
+    // Oyunu başlat veya yeniden başlat (ENTER) => // Start or restart the game (ENTER)
+    void start();
+    // resetGame() - tüm oyun durumunu ilk hale getir => // Reset all game state
+    void reset();
+    // Oyunu tek bir sabit adım (dt) ilerlet => // Advance the game by one fixed step (dt)
+    void step(float dt);
+    // Tüm rastgele akışları tek bir tohumdan yeniden başlat; aynı tohum + aynı girdi = aynı oyun
+    // Reseed every random stream from one seed; same seed + same input = same game
+    void seed(uint64_t value);
+    uint64_t seedValue() const { return currentSeed; }
+    // Oyuncuyu sola (-1) veya sağa (+1) bir adım taşı => // Move the player one step left (-1) or right (+1)
+    void movePlayer(int direction);
+    // Girdiyi mevcut duruma göre uygula (bir sonraki step'ten önce çağır)
+    // Apply an input according to the current state (call before the next step)
+    void applyInput(InputAction action);
+    // Şimdiye kadar çalışan step() sayısı; replay olayları bu indeksle eşlenir
+    // Number of step() calls so far; replay events are keyed by this index
+    uint64_t stepIndex() const { return steps; }
+
+    // Efektler => // Effects
+    void createParticle(float x, float y, float vx, float vy,
+                        float r, float g, float b, float a,
+                        float lifetime, float size, float rotation = 0.0f, float rotationSpeed = 0.0f);
+    void updateParticles(float deltaTime);
+    void createBlockExplosion(float x, float y, float r, float g, float b);
+    void createLevelUpEffect();
+    void createHeartEffect(float x, float y);
+    void createShieldBreakEffect(float x, float y);
+    void createMassiveExplosion(float x, float y, float radius);
+
+    // Blok ekle (önceki pozisyon = pozisyon, düşüş hızı ölçeği 1) => // Add a block (previous position = position, fall scale 1)
+    size_t addBlock(float x, float y, int shape, float r, float g, float b, int pattern, float originX);
+    size_t addPowerUp(float x, float y, int type);
+
+    // Sistemler satır indeksleriyle çalışır => // Systems work on row indices
+    void updateBlockMovement(size_t row);
+    void respawnBlock(size_t row);
+    void applyPowerUp(int type);
+
+    // Süreli etkiler => // Timed effects
+    bool hasEffect(TimedEffect effect) const { return effects.isActive((int)effect); }
+    // Etkiyi başlat; zaten etkinse süresini yenile => // Start an effect; refresh its time if already active
+    void startEffect(TimedEffect effect, float duration) { effects.apply((int)effect, duration); }
+    // Etkiyi bitiş işlemi yapmadan kaldır (ör. kalkan kırılması) => // Remove an effect without running its expiry (e.g. a broken shield)
+    void cancelEffect(TimedEffect effect) { effects.cancel((int)effect); }
+
+    // Oyuncuya değen power-up / blok indekslerini collisionCandidates'e artan sırayla yaz
+    // Write the indices of power-ups / blocks touching the player into collisionCandidates, ascending
+    void findPowerUpCollisions();
+    void findBlockCollisions();
+
+    float playerX = 0.0f; // Oyuncu pozisyonu (Yatay)
+    float previousPlayerX = 0.0f; // Önceki adımdaki pozisyon (çizim interpolasyonu için)
+    // Tuş durumu, oyun durumu değil: yeniden başlatmada korunur => // Key state, not game state: kept across restarts
+    uint8_t heldKeys = 0;
+    // Son adımdan beri basılan tuşlar; aynı adımda basılıp bırakılan dokunuş da bir adım hareket eder
+    // Keys pressed since the last step; a tap pressed and released before the same step still moves once
+    uint8_t pressedKeys = 0;
+    float playerSpeed = 0.07f;
+    float originalPlayerSpeed = 0.05f;
+    float blockSpeed = 0.01f; // İlk blok hızı (Seviye ile artar)
+    int score = 0;
+    int health = 3;
+    int level = 1;
+    bool gameOver = false;
+    bool gameStarted = false;
+    bool isPaused = false;
+
+    float backgroundColor = 0.0f;
+    bool colorIncreasing = true; // Arka plan renk animasyon yönü
+
+    // Geçiş efektleri
+    bool fadeInEffect = false;
+    bool fadeOutEffect = false;
+    float fadeAlpha = 1.0f;
+
+    // Zaman yavaşlatma etkinken düşüş hızı çarpanı => // Fall speed multiplier while time slow is active
+    float timeSlowFactor = 1.0f;
+
+    // Varlıklar bileşen dizilerinde => // Entities live in component arrays
+    BlockArchetype blocks;
+    PowerUpArchetype powerUps;
+    // Süreli etkiler; her adım bir tik => // Timed effects; one tick per step
+    EffectScheduler effects{SIM_DT};
+    ParticleSystem particles{MAX_PARTICLES}; // SoA parçacık deposu
+
+    // Çarpışma geniş fazı; her adımda blok/power-up merkezlerinden yeniden kurulur.
+    // blockGrid blok-blok (forEachPairWithin) ve parçacık-blok (queryRadius) sorguları için de kullanılabilir.
+    // Collision broadphase, rebuilt from block/power-up centres every step.
+    // blockGrid also serves block-vs-block (forEachPairWithin) and particle-vs-block (queryRadius) queries.
+    UniformGrid blockGrid{-2.0f, -2.0f, 2.0f, 5.0f, 0.5f};
+    UniformGrid powerUpGrid{-2.0f, -2.0f, 2.0f, 5.0f, 0.5f};
+
+    // Geniş fazdan gelen aday indeksler (yeniden kullanılır) => // Candidate indices from the broadphase (reused)
+    std::vector<uint32_t> collisionCandidates;
+
+    // Rastgele akışlar: oyun kararları (power-up şansı/türü), doğma (blok/power-up
+    // konumu, şekli, deseni) ve görsel efektler (renkler, parçacıklar)
+    // Random streams: gameplay decisions (power-up chance/type), spawning (block and
+    // power-up position, shape, pattern) and cosmetic effects (colours, particles)
+    Rng gameplayRng;
+    Rng spawnRng;
+    Rng cosmeticRng;
+
+    // Bu adımda üretilen ses olayları => // Sound events produced since the last drain
+    std::vector<SoundEvent> soundEvents;
+
+    // Aşama zamanlayıcıları buraya yazar; nullptr ise ölçüm yapılmaz
+    // Stage timers report here; no measuring when nullptr
+    Profiler* profiler = nullptr;
+
+    // Parçacık güncellemesi bu iş sistemine dağıtılır; nullptr ise tek iş parçacığı.
+    // Sonuç her iki durumda da bit bit aynıdır.
+    // Particle updates are spread over this job system; single-threaded when nullptr.
+    // The result is bit-identical either way.
+    JobSystem* jobs = nullptr;
+
+    // Konsola oyun olaylarını yaz (headless modda kapalı) => // Log game events to the console (off in headless mode)
+    bool logEvents = true;
+
+private:
+    // Etki türlerini uygulanma/bitiş işlemleriyle kaydet => // Register the effect types with their apply/expire actions
+    void registerEffects();
+
+    uint64_t currentSeed = 0;
+    uint64_t steps = 0;
+};
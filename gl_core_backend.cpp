@@ -0,0 +1,362 @@
+#include "gl_core_backend.h"
+#include "shader_utils.h"
+#include <cstddef>
+#include <iostream>
+
+// Attribute konumları; her program kendi alt kümesini kullanır
+// Attribute locations; each program uses its own subset
+static const GLuint ATTRIB_POSITION = 0;
+static const GLuint ATTRIB_COLOR = 1;
+static const GLuint ATTRIB_TEXCOORD = 1;
+static const GLuint ATTRIB_CORNER = 0;
+static const GLuint ATTRIB_RECT = 1;
+static const GLuint ATTRIB_INSTANCE_COLOR = 2;
+static const GLuint ATTRIB_STYLE = 3;
+
+static const char* COLOR_VERTEX_SHADER = R"(
+#version 330 core
+in vec2 position;
+in vec4 color;
+out vec4 vertexColor;
+void main() {
+    vertexColor = color;
+    gl_Position = vec4(position, 0.0, 1.0);
+}
+)";
+
+static const char* COLOR_FRAGMENT_SHADER = R"(
+#version 330 core
+in vec4 vertexColor;
+out vec4 fragColor;
+void main() {
+    fragColor = vertexColor;
+}
+)";
+
+// Uyumluluk yolundaki sprite shader'ının 3.30 hali => // The 3.30 version of the compatibility path's sprite shader
+static const char* SPRITE_VERTEX_SHADER = R"(
+#version 330 core
+in vec2 corner;     // Birim kare köşesi (0..1)
+in vec4 instRect;   // x, y (sol üst), genişlik, yükseklik
+in vec4 instColor;
+in vec2 instStyle;  // şekil, parlaklık
+out vec2 uv;
+out vec4 color;
+out float shape;
+void main() {
+    uv = corner;
+    vec2 position = vec2(instRect.x + corner.x * instRect.z, instRect.y - corner.y * instRect.w);
+    gl_Position = vec4(position, 0.0, 1.0);
+    color = vec4(min(instColor.rgb * instStyle.y, vec3(1.0)), instColor.a);
+    shape = instStyle.x;
+}
+)";
+
+static const char* SPRITE_FRAGMENT_SHADER = R"(
+#version 330 core
+in vec2 uv;         // (0,0) sol üst, (1,1) sağ alt
+in vec4 color;
+in float shape;
+out vec4 fragColor;
+void main() {
+    int s = int(shape + 0.5);
+    bool inside = true;
+    if (s == 1) {
+        // Üçgen: üst kenar tam genişlik, tepe altta ortada
+        inside = abs(uv.x - 0.5) <= 0.5 * (1.0 - uv.y);
+    } else if (s == 2) {
+        // Daire: kareye iç teğet
+        inside = length(uv - 0.5) <= 0.5;
+    } else if (s == 3) {
+        // Kalp: üstte iki yarım daire, altta üçgen
+        vec2 p = vec2(uv.x * 2.0 - 1.0, 0.5 - uv.y * 2.0);
+        if (p.y >= 0.0) {
+            inside = length(p - vec2(-0.5, 0.0)) <= 0.5 || length(p - vec2(0.5, 0.0)) <= 0.5;
+        } else {
+            inside = abs(p.x) <= 1.0 + p.y / 1.5;
+        }
+    }
+    if (!inside) {
+        discard;
+    }
+    fragColor = color;
+}
+)";
+
+// Atlas tek kanallı R8; kırmızı kanal kapsama (alfa) olarak okunur
+// The atlas is single-channel R8; the red channel is read as coverage (alpha)
+static const char* TEXT_VERTEX_SHADER = R"(
+#version 330 core
+in vec2 position;
+in vec2 texCoord;
+uniform vec2 offset;
+out vec2 uv;
+void main() {
+    uv = texCoord;
+    gl_Position = vec4(position + offset, 0.0, 1.0);
+}
+)";
+
+static const char* TEXT_FRAGMENT_SHADER = R"(
+#version 330 core
+in vec2 uv;
+uniform sampler2D font;
+uniform vec3 tint;
+out vec4 fragColor;
+void main() {
+    fragColor = vec4(tint, texture(font, uv).r);
+}
+)";
+
+bool GlCoreBackend::init() {
+    if (!GLEW_VERSION_3_3) {
+        std::cerr << "OpenGL 3.3 is not available" << std::endl;
+        return false;
+    }
+
+    colorProgram = createShaderProgram("color", COLOR_VERTEX_SHADER, COLOR_FRAGMENT_SHADER, {
+        { ATTRIB_POSITION, "position" },
+        { ATTRIB_COLOR, "color" },
+    });
+    spriteProgram = createShaderProgram("sprite", SPRITE_VERTEX_SHADER, SPRITE_FRAGMENT_SHADER, {
+        { ATTRIB_CORNER, "corner" },
+        { ATTRIB_RECT, "instRect" },
+        { ATTRIB_INSTANCE_COLOR, "instColor" },
+        { ATTRIB_STYLE, "instStyle" },
+    });
+    textProgram = createShaderProgram("text", TEXT_VERTEX_SHADER, TEXT_FRAGMENT_SHADER, {
+        { ATTRIB_POSITION, "position" },
+        { ATTRIB_TEXCOORD, "texCoord" },
+    });
+    if (colorProgram == 0 || spriteProgram == 0 || textProgram == 0) {
+        release();
+        return false;
+    }
+    textOffsetLocation = glGetUniformLocation(textProgram, "offset");
+    textTintLocation = glGetUniformLocation(textProgram, "tint");
+
+    glGenBuffers(1, &streamBuffer);
+    glGenBuffers(1, &quadIndexBuffer);
+    glGenBuffers(1, &spriteQuadBuffer);
+    glGenBuffers(1, &spriteInstanceBuffer);
+
+    // Renkli köşeler: akış buffer'ı, dörtgen index'leri VAO'ya bağlı
+    // Coloured vertices: the streaming buffer, with the quad indices attached to the VAO
+    glGenVertexArrays(1, &colorVao);
+    glBindVertexArray(colorVao);
+    glBindBuffer(GL_ARRAY_BUFFER, streamBuffer);
+    glEnableVertexAttribArray(ATTRIB_POSITION);
+    glVertexAttribPointer(ATTRIB_POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(ColorVertex), (const void*)offsetof(ColorVertex, x));
+    glEnableVertexAttribArray(ATTRIB_COLOR);
+    glVertexAttribPointer(ATTRIB_COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ColorVertex), (const void*)offsetof(ColorVertex, r));
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quadIndexBuffer);
+
+    // Sprite'lar: bölen (divisor) VAO durumudur, bir kez ayarlanır
+    // Sprites: the divisor is VAO state, so it is set once
+    const float corners[] = {
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        0.0f, 1.0f,
+        1.0f, 1.0f,
+    };
+    glGenVertexArrays(1, &spriteVao);
+    glBindVertexArray(spriteVao);
+    glBindBuffer(GL_ARRAY_BUFFER, spriteQuadBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+    glEnableVertexAttribArray(ATTRIB_CORNER);
+    glVertexAttribPointer(ATTRIB_CORNER, 2, GL_FLOAT, GL_FALSE, 0, (const void*)0);
+    const GLsizei stride = sizeof(SpriteInstance);
+    glBindBuffer(GL_ARRAY_BUFFER, spriteInstanceBuffer);
+    glEnableVertexAttribArray(ATTRIB_RECT);
+    glVertexAttribPointer(ATTRIB_RECT, 4, GL_FLOAT, GL_FALSE, stride, (const void*)offsetof(SpriteInstance, x));
+    glVertexAttribDivisor(ATTRIB_RECT, 1);
+    glEnableVertexAttribArray(ATTRIB_INSTANCE_COLOR);
+    glVertexAttribPointer(ATTRIB_INSTANCE_COLOR, 4, GL_FLOAT, GL_FALSE, stride, (const void*)offsetof(SpriteInstance, r));
+    glVertexAttribDivisor(ATTRIB_INSTANCE_COLOR, 1);
+    glEnableVertexAttribArray(ATTRIB_STYLE);
+    glVertexAttribPointer(ATTRIB_STYLE, 2, GL_FLOAT, GL_FALSE, stride, (const void*)offsetof(SpriteInstance, shape));
+    glVertexAttribDivisor(ATTRIB_STYLE, 1);
+
+    // Metin: köşe buffer'ı ağa göre değişir, index'ler ortak
+    // Text: the vertex buffer changes per mesh, the indices are shared
+    glGenVertexArrays(1, &textVao);
+    glBindVertexArray(textVao);
+    glEnableVertexAttribArray(ATTRIB_POSITION);
+    glEnableVertexAttribArray(ATTRIB_TEXCOORD);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quadIndexBuffer);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    reserveQuads(1);
+    return true;
+}
+
+void GlCoreBackend::release() {
+    GLuint* programs[] = { &colorProgram, &spriteProgram, &textProgram };
+    for (GLuint* program : programs) {
+        if (*program != 0) {
+            glDeleteProgram(*program);
+            *program = 0;
+        }
+    }
+    GLuint* arrays[] = { &colorVao, &spriteVao, &textVao };
+    for (GLuint* array : arrays) {
+        if (*array != 0) {
+            glDeleteVertexArrays(1, array);
+            *array = 0;
+        }
+    }
+    GLuint* buffers[] = { &streamBuffer, &spriteQuadBuffer, &spriteInstanceBuffer, &quadIndexBuffer };
+    for (GLuint* buffer : buffers) {
+        if (*buffer != 0) {
+            glDeleteBuffers(1, buffer);
+            *buffer = 0;
+        }
+    }
+    quadCapacity = 0;
+    if (fontTexture != 0) {
+        glDeleteTextures(1, &fontTexture);
+        fontTexture = 0;
+    }
+    batch.clear();
+}
+
+void GlCoreBackend::beginFrame(float r, float g, float b) {
+    batch.clear();
+    glClearColor(r, g, b, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+void GlCoreBackend::uploadColored(const ColorVertex* vertices, size_t count) {
+    glUseProgram(colorProgram);
+    glBindVertexArray(colorVao);
+    glBindBuffer(GL_ARRAY_BUFFER, streamBuffer);
+    // Her yüklemede buffer'ı yetim bırak (orphan) ki sürücü önceki çizimi beklemesin
+    // Orphan the buffer on every upload so the driver does not stall on the previous draw
+    glBufferData(GL_ARRAY_BUFFER, count * sizeof(ColorVertex), vertices, GL_STREAM_DRAW);
+}
+
+void GlCoreBackend::triangles(const ColorVertex* vertices, size_t count) {
+    batch.insert(batch.end(), vertices, vertices + count);
+}
+
+void GlCoreBackend::flushTriangles() {
+    if (batch.empty()) {
+        return;
+    }
+    uploadColored(batch.data(), batch.size());
+    glDrawArrays(GL_TRIANGLES, 0, (GLsizei)batch.size());
+    batch.clear();
+}
+
+void GlCoreBackend::lines(const ColorVertex* vertices, size_t count) {
+    flushTriangles();
+    if (count == 0) {
+        return;
+    }
+    uploadColored(vertices, count);
+    glDrawArrays(GL_LINES, 0, (GLsizei)count);
+}
+
+void GlCoreBackend::reserveQuads(size_t quadCount) {
+    if (quadCount <= quadCapacity) {
+        return;
+    }
+    size_t capacity = quadIndexCapacity(quadCapacity, quadCount);
+    std::vector<uint32_t> indices;
+    buildQuadIndices(capacity, indices);
+
+    // Index buffer bağlaması VAO durumudur; buffer'ın kendisine sahip VAO üzerinden yaz
+    // The index buffer binding is VAO state; write the buffer through a VAO that owns it
+    glBindVertexArray(colorVao);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
+    glBindVertexArray(0);
+    quadCapacity = capacity;
+}
+
+void GlCoreBackend::quads(const ColorVertex* vertices, size_t quadCount) {
+    flushTriangles();
+    if (quadCount == 0) {
+        return;
+    }
+    reserveQuads(quadCount);
+    uploadColored(vertices, quadCount * 4);
+    glDrawElements(GL_TRIANGLES, (GLsizei)(quadCount * 6), GL_UNSIGNED_INT, (const void*)0);
+}
+
+void GlCoreBackend::sprites(const SpriteInstance* instances, size_t count) {
+    flushTriangles();
+    if (count == 0 || spriteProgram == 0) {
+        return;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, spriteInstanceBuffer);
+    glBufferData(GL_ARRAY_BUFFER, count * sizeof(SpriteInstance), instances, GL_STREAM_DRAW);
+
+    glUseProgram(spriteProgram);
+    glBindVertexArray(spriteVao);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)count);
+}
+
+bool GlCoreBackend::loadFont(const uint8_t* pixels, int width, int height) {
+    // Core profilde GL_ALPHA yok; tek kanal R8 olarak yüklenir ve shader'da alfa olur
+    // Core profile has no GL_ALPHA; the single channel is uploaded as R8 and becomes alpha in the shader
+    glGenTextures(1, &fontTexture);
+    glBindTexture(GL_TEXTURE_2D, fontTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    // Piksel font için en yakın komşu filtre => // Nearest filtering for the pixel font
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    if (glGetError() != GL_NO_ERROR) {
+        glDeleteTextures(1, &fontTexture);
+        fontTexture = 0;
+        return false;
+    }
+    return true;
+}
+
+uint32_t GlCoreBackend::createMesh() {
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+    return buffer;
+}
+
+void GlCoreBackend::updateMesh(uint32_t mesh, const TextVertex* vertices, size_t count) {
+    glBindBuffer(GL_ARRAY_BUFFER, mesh);
+    glBufferData(GL_ARRAY_BUFFER, count * sizeof(TextVertex), vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void GlCoreBackend::destroyMesh(uint32_t mesh) {
+    GLuint buffer = mesh;
+    glDeleteBuffers(1, &buffer);
+}
+
+void GlCoreBackend::drawText(uint32_t mesh, size_t vertexCount, float x, float y, float r, float g, float b) {
+    flushTriangles();
+    if (fontTexture == 0 || vertexCount == 0) {
+        return;
+    }
+    reserveQuads(vertexCount / 4);
+
+    glUseProgram(textProgram);
+    glUniform2f(textOffsetLocation, x, y);
+    glUniform3f(textTintLocation, r, g, b);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, fontTexture);
+
+    glBindVertexArray(textVao);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh);
+    glVertexAttribPointer(ATTRIB_POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (const void*)offsetof(TextVertex, x));
+    glVertexAttribPointer(ATTRIB_TEXCOORD, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (const void*)offsetof(TextVertex, u));
+    glDrawElements(GL_TRIANGLES, (GLsizei)(vertexCount / 4 * 6), GL_UNSIGNED_INT, (const void*)0);
+}
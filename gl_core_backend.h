@@ -0,0 +1,67 @@
+#pragma once
+
+// OpenGL 3.3 core profil çizim arka ucu: yalnızca VAO, VBO ve GLSL 3.30 shader'ları.
+// OpenGL 3.3 core profile render backend: VAOs, VBOs and GLSL 3.30 shaders only.
+//
+// triangles() çizmez, köşeleri kare boyunca bir CPU dizisinde biriktirir. Başka türde
+// bir çizim (çizgi, parçacık, sprite, metin) ya da endFrame() gelince birikenler tek
+// bir glDrawArrays ile gönderilir; böylece çizim sırası korunur ve onlarca küçük şekil
+// tek çağrıya iner. Mesa llvmpipe üzerinde de çalışır (ör. Xvfb altında CI).
+// triangles() does not draw; it gathers vertices in a CPU array over the frame. When a
+// different kind of draw (lines, particles, sprites, text) or endFrame() comes, the
+// gathered vertices go out in one glDrawArrays, so the draw order is kept and dozens
+// of small shapes become one call. Also runs on Mesa llvmpipe (e.g. CI under Xvfb).
+
+#include <GL/glew.h>
+#include <vector>
+#include "render_backend.h"
+
+class GlCoreBackend : public RenderBackend {
+public:
+    const char* name() const override { return "core"; }
+    bool init() override;
+    void release() override;
+
+    void beginFrame(float r, float g, float b) override;
+    void endFrame() override { flushTriangles(); }
+
+    void triangles(const ColorVertex* vertices, size_t count) override;
+    void lines(const ColorVertex* vertices, size_t count) override;
+    void quads(const ColorVertex* vertices, size_t quadCount) override;
+    void reserveQuads(size_t quadCount) override;
+
+    bool supportsSprites() const override { return spriteProgram != 0; }
+    void sprites(const SpriteInstance* instances, size_t count) override;
+
+    bool loadFont(const uint8_t* pixels, int width, int height) override;
+    uint32_t createMesh() override;
+    void updateMesh(uint32_t mesh, const TextVertex* vertices, size_t count) override;
+    void destroyMesh(uint32_t mesh) override;
+    void drawText(uint32_t mesh, size_t vertexCount, float x, float y, float r, float g, float b) override;
+
+private:
+    // Biriken üçgenleri çiz => // Draw the gathered triangles
+    void flushTriangles();
+    // Renkli köşeleri akış buffer'ına yükle ve renkli VAO'yu hazırla
+    // Upload coloured vertices into the streaming buffer and bind the coloured VAO
+    void uploadColored(const ColorVertex* vertices, size_t count);
+
+    GLuint colorProgram = 0;
+    GLuint spriteProgram = 0;
+    GLuint textProgram = 0;
+    GLint textOffsetLocation = -1;
+    GLint textTintLocation = -1;
+
+    GLuint colorVao = 0;       // Konum + renk, quadIndexBuffer bağlı => // Position + colour, quadIndexBuffer attached
+    GLuint spriteVao = 0;      // Birim kare + örnek başına veri => // Unit quad + per-instance data
+    GLuint textVao = 0;        // Konum + doku koordinatı => // Position + texture coordinate
+    GLuint streamBuffer = 0;
+    GLuint spriteQuadBuffer = 0;
+    GLuint spriteInstanceBuffer = 0;
+    GLuint quadIndexBuffer = 0;
+    size_t quadCapacity = 0;
+
+    GLuint fontTexture = 0;
+
+    std::vector<ColorVertex> batch; // Kare başına yeniden doldurulur, kapasite korunur
+};
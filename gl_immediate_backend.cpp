@@ -0,0 +1,296 @@
+#include "gl_immediate_backend.h"
+#include "shader_utils.h"
+#include <cstddef>
+#include <iostream>
+
+// Attribute konumları => // Attribute locations
+static const GLuint ATTRIB_CORNER = 0;
+static const GLuint ATTRIB_RECT = 1;
+static const GLuint ATTRIB_COLOR = 2;
+static const GLuint ATTRIB_STYLE = 3;
+
+static const char* SPRITE_VERTEX_SHADER = R"(
+#version 120
+attribute vec2 corner;     // Birim kare köşesi (0..1)
+attribute vec4 instRect;   // x, y (sol üst), genişlik, yükseklik
+attribute vec4 instColor;
+attribute vec2 instStyle;  // şekil, parlaklık
+varying vec2 uv;
+varying vec4 color;
+varying float shape;
+void main() {
+    uv = corner;
+    vec2 position = vec2(instRect.x + corner.x * instRect.z, instRect.y - corner.y * instRect.w);
+    gl_Position = gl_ModelViewProjectionMatrix * vec4(position, 0.0, 1.0);
+    color = vec4(min(instColor.rgb * instStyle.y, vec3(1.0)), instColor.a);
+    shape = instStyle.x;
+}
+)";
+
+static const char* SPRITE_FRAGMENT_SHADER = R"(
+#version 120
+varying vec2 uv;           // (0,0) sol üst, (1,1) sağ alt
+varying vec4 color;
+varying float shape;
+void main() {
+    int s = int(shape + 0.5);
+    bool inside = true;
+    if (s == 1) {
+        // Üçgen: üst kenar tam genişlik, tepe altta ortada
+        inside = abs(uv.x - 0.5) <= 0.5 * (1.0 - uv.y);
+    } else if (s == 2) {
+        // Daire: kareye iç teğet
+        inside = length(uv - 0.5) <= 0.5;
+    } else if (s == 3) {
+        // Kalp: üstte iki yarım daire, altta üçgen (drawPowerUp ile aynı oranlar)
+        vec2 p = vec2(uv.x * 2.0 - 1.0, 0.5 - uv.y * 2.0);
+        if (p.y >= 0.0) {
+            inside = length(p - vec2(-0.5, 0.0)) <= 0.5 || length(p - vec2(0.5, 0.0)) <= 0.5;
+        } else {
+            inside = abs(p.x) <= 1.0 + p.y / 1.5;
+        }
+    }
+    if (!inside) {
+        discard;
+    }
+    gl_FragColor = color;
+}
+)";
+
+bool GlImmediateBackend::init() {
+    // Sprite'lar isteğe bağlı; olmazsa şekiller tek tek çizilir
+    // Sprites are optional; without them the shapes are drawn one by one
+    initSprites();
+    return true;
+}
+
+bool GlImmediateBackend::initSprites() {
+    if (!GLEW_ARB_instanced_arrays || !GLEW_ARB_draw_instanced) {
+        std::cerr << "Instanced rendering not supported, using immediate-mode sprites" << std::endl;
+        return false;
+    }
+
+    spriteProgram = createShaderProgram("sprite", SPRITE_VERTEX_SHADER, SPRITE_FRAGMENT_SHADER, {
+        { ATTRIB_CORNER, "corner" },
+        { ATTRIB_RECT, "instRect" },
+        { ATTRIB_COLOR, "instColor" },
+        { ATTRIB_STYLE, "instStyle" },
+    });
+    if (spriteProgram == 0) {
+        return false;
+    }
+
+    // Birim kare, triangle strip sırasıyla => // Unit quad in triangle-strip order
+    const float corners[] = {
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        0.0f, 1.0f,
+        1.0f, 1.0f,
+    };
+    glGenBuffers(1, &spriteQuadBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, spriteQuadBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+    glGenBuffers(1, &spriteInstanceBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return true;
+}
+
+void GlImmediateBackend::release() {
+    if (spriteProgram != 0) {
+        glDeleteProgram(spriteProgram);
+        spriteProgram = 0;
+    }
+    GLuint* buffers[] = { &spriteQuadBuffer, &spriteInstanceBuffer, &quadVertexBuffer, &quadIndexBuffer };
+    for (GLuint* buffer : buffers) {
+        if (*buffer != 0) {
+            glDeleteBuffers(1, buffer);
+            *buffer = 0;
+        }
+    }
+    quadCapacity = 0;
+    if (fontTexture != 0) {
+        glDeleteTextures(1, &fontTexture);
+        fontTexture = 0;
+    }
+}
+
+void GlImmediateBackend::beginFrame(float r, float g, float b) {
+    glClearColor(r, g, b, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+void GlImmediateBackend::triangles(const ColorVertex* vertices, size_t count) {
+    glBegin(GL_TRIANGLES);
+    for (size_t i = 0; i < count; i++) {
+        glColor4ub(vertices[i].r, vertices[i].g, vertices[i].b, vertices[i].a);
+        glVertex2f(vertices[i].x, vertices[i].y);
+    }
+    glEnd();
+}
+
+void GlImmediateBackend::lines(const ColorVertex* vertices, size_t count) {
+    glBegin(GL_LINES);
+    for (size_t i = 0; i < count; i++) {
+        glColor4ub(vertices[i].r, vertices[i].g, vertices[i].b, vertices[i].a);
+        glVertex2f(vertices[i].x, vertices[i].y);
+    }
+    glEnd();
+}
+
+void GlImmediateBackend::reserveQuads(size_t quadCount) {
+    if (quadCount <= quadCapacity) {
+        return;
+    }
+    size_t capacity = quadIndexCapacity(quadCapacity, quadCount);
+    std::vector<uint32_t> indices;
+    buildQuadIndices(capacity, indices);
+
+    if (quadIndexBuffer == 0) {
+        glGenBuffers(1, &quadIndexBuffer);
+    }
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quadIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    quadCapacity = capacity;
+}
+
+void GlImmediateBackend::quads(const ColorVertex* vertices, size_t quadCount) {
+    if (quadCount == 0) {
+        return;
+    }
+    reserveQuads(quadCount);
+
+    if (quadVertexBuffer == 0) {
+        glGenBuffers(1, &quadVertexBuffer);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, quadVertexBuffer);
+    // Her karede buffer'ı yetim bırak (orphan) ki sürücü önceki kareyi beklemesin
+    // Orphan the buffer every frame so the driver does not stall on the previous one
+    glBufferData(GL_ARRAY_BUFFER, quadCount * 4 * sizeof(ColorVertex), vertices, GL_STREAM_DRAW);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(ColorVertex), (const void*)offsetof(ColorVertex, x));
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(ColorVertex), (const void*)offsetof(ColorVertex, r));
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quadIndexBuffer);
+    glDrawElements(GL_TRIANGLES, (GLsizei)(quadCount * 6), GL_UNSIGNED_INT, (const void*)0);
+
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void GlImmediateBackend::sprites(const SpriteInstance* instances, size_t count) {
+    if (count == 0 || spriteProgram == 0) {
+        return;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, spriteInstanceBuffer);
+    glBufferData(GL_ARRAY_BUFFER, count * sizeof(SpriteInstance), instances, GL_STREAM_DRAW);
+
+    glUseProgram(spriteProgram);
+
+    // Köşe başına veri => // Per-vertex data
+    glBindBuffer(GL_ARRAY_BUFFER, spriteQuadBuffer);
+    glEnableVertexAttribArray(ATTRIB_CORNER);
+    glVertexAttribPointer(ATTRIB_CORNER, 2, GL_FLOAT, GL_FALSE, 0, (const void*)0);
+
+    // Örnek başına veri => // Per-instance data
+    const GLsizei stride = sizeof(SpriteInstance);
+    glBindBuffer(GL_ARRAY_BUFFER, spriteInstanceBuffer);
+    glEnableVertexAttribArray(ATTRIB_RECT);
+    glVertexAttribPointer(ATTRIB_RECT, 4, GL_FLOAT, GL_FALSE, stride, (const void*)offsetof(SpriteInstance, x));
+    glVertexAttribDivisorARB(ATTRIB_RECT, 1);
+    glEnableVertexAttribArray(ATTRIB_COLOR);
+    glVertexAttribPointer(ATTRIB_COLOR, 4, GL_FLOAT, GL_FALSE, stride, (const void*)offsetof(SpriteInstance, r));
+    glVertexAttribDivisorARB(ATTRIB_COLOR, 1);
+    glEnableVertexAttribArray(ATTRIB_STYLE);
+    glVertexAttribPointer(ATTRIB_STYLE, 2, GL_FLOAT, GL_FALSE, stride, (const void*)offsetof(SpriteInstance, shape));
+    glVertexAttribDivisorARB(ATTRIB_STYLE, 1);
+
+    glDrawArraysInstancedARB(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)count);
+
+    // Sabit işlevli çizimi bozmamak için durumu geri al => // Restore state for the fixed-function paths
+    for (GLuint attribute : { ATTRIB_RECT, ATTRIB_COLOR, ATTRIB_STYLE }) {
+        glVertexAttribDivisorARB(attribute, 0);
+        glDisableVertexAttribArray(attribute);
+    }
+    glDisableVertexAttribArray(ATTRIB_CORNER);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glUseProgram(0);
+}
+
+bool GlImmediateBackend::loadFont(const uint8_t* pixels, int width, int height) {
+    // Sabit fonksiyonlu hatta R8 kullanılamaz; tek kanal GL_ALPHA8 olarak yüklenir ve
+    // GL_MODULATE ile glColor rengini alır
+    // Fixed-function GL cannot sample R8 as coverage; the single channel is uploaded as
+    // GL_ALPHA8 and picks up the glColor through GL_MODULATE
+    glGenTextures(1, &fontTexture);
+    glBindTexture(GL_TEXTURE_2D, fontTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA8, width, height, 0, GL_ALPHA, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    // Piksel font için en yakın komşu filtre => // Nearest filtering for the pixel font
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    if (glGetError() != GL_NO_ERROR) {
+        glDeleteTextures(1, &fontTexture);
+        fontTexture = 0;
+        return false;
+    }
+    return true;
+}
+
+uint32_t GlImmediateBackend::createMesh() {
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+    return buffer;
+}
+
+void GlImmediateBackend::updateMesh(uint32_t mesh, const TextVertex* vertices, size_t count) {
+    glBindBuffer(GL_ARRAY_BUFFER, mesh);
+    glBufferData(GL_ARRAY_BUFFER, count * sizeof(TextVertex), vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void GlImmediateBackend::destroyMesh(uint32_t mesh) {
+    GLuint buffer = mesh;
+    glDeleteBuffers(1, &buffer);
+}
+
+void GlImmediateBackend::drawText(uint32_t mesh, size_t vertexCount, float x, float y, float r, float g, float b) {
+    if (fontTexture == 0 || vertexCount == 0) {
+        return;
+    }
+
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, fontTexture);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+    glColor3f(r, g, b);
+
+    glPushMatrix();
+    glTranslatef(x, y, 0.0f);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mesh);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(TextVertex), (const void*)offsetof(TextVertex, x));
+    glTexCoordPointer(2, GL_FLOAT, sizeof(TextVertex), (const void*)offsetof(TextVertex, u));
+    glDrawArrays(GL_QUADS, 0, (GLsizei)vertexCount);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glPopMatrix();
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDisable(GL_TEXTURE_2D);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+// Sabit işlevli (uyumluluk profili) çizim arka ucu: glBegin/glEnd, istemci dizileri,
+// GL_MODULATE doku ortamı. Sprite'lar ARB örnekleme eklentileri varsa GLSL 1.20 ile
+// çizilir. OpenGL 3.3 core bağlam açılamayan sürücüler için yedek yol.
+// Fixed-function (compatibility profile) render backend: glBegin/glEnd, client arrays,
+// GL_MODULATE texture environment. Sprites are drawn with GLSL 1.20 when the ARB
+// instancing extensions exist. The fallback for drivers without an OpenGL 3.3 core context.
+
+#include <GL/glew.h>
+#include "render_backend.h"
+
+class GlImmediateBackend : public RenderBackend {
+public:
+    const char* name() const override { return "immediate"; }
+    bool init() override;
+    void release() override;
+
+    void beginFrame(float r, float g, float b) override;
+    void endFrame() override {}
+
+    void triangles(const ColorVertex* vertices, size_t count) override;
+    void lines(const ColorVertex* vertices, size_t count) override;
+    void quads(const ColorVertex* vertices, size_t quadCount) override;
+    void reserveQuads(size_t quadCount) override;
+
+    bool supportsSprites() const override { return spriteProgram != 0; }
+    void sprites(const SpriteInstance* instances, size_t count) override;
+
+    bool loadFont(const uint8_t* pixels, int width, int height) override;
+    uint32_t createMesh() override;
+    void updateMesh(uint32_t mesh, const TextVertex* vertices, size_t count) override;
+    void destroyMesh(uint32_t mesh) override;
+    void drawText(uint32_t mesh, size_t vertexCount, float x, float y, float r, float g, float b) override;
+
+private:
+    bool initSprites();
+
+    GLuint spriteProgram = 0;
+    GLuint spriteQuadBuffer = 0;
+    GLuint spriteInstanceBuffer = 0;
+
+    GLuint quadVertexBuffer = 0;
+    GLuint quadIndexBuffer = 0;
+    size_t quadCapacity = 0; // Index buffer'ın kaç dörtgeni kapsadığı
+
+    GLuint fontTexture = 0;
+};
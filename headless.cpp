@@ -0,0 +1,256 @@
+#include "headless.h"
+#include "game_simulation.h"
+#include "replay.h"
+#include "profiler.h"
+#include "job_system.h"
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include <memory>
+
+bool parseHeadlessArgs(int argc, char** argv, HeadlessOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            options.enabled = true;
+        } else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            long long frames = std::atoll(argv[++i]);
+            if (frames > 0) {
+                options.frames = frames;
+            } else {
+                std::cerr << "Invalid --frames value, using " << options.frames << std::endl;
+            }
+        } else if (std::strcmp(argv[i], "--particles") == 0 && i + 1 < argc) {
+            options.particleCapacity = std::atoll(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+            options.hasSeed = true;
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            options.replayPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            options.recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            options.tracePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            options.threads = std::max(0, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--input-check") == 0) {
+            options.inputCheck = true;
+        }
+    }
+    return options.enabled;
+}
+
+// --threads için iş sistemi; çağıran iş parçacığı da çalıştığından işçi sayısı bir eksiktir
+// Job system for --threads; the calling thread works too, so there is one worker fewer
+static std::unique_ptr<JobSystem> makeJobSystem(const HeadlessOptions& options) {
+    if (options.threads == 1) {
+        return nullptr;
+    }
+    return std::make_unique<JobSystem>(options.threads > 1 ? options.threads - 1 : -1);
+}
+
+// Kaydı pencere olmadan baştan sona oynat ve son durumu kayıtla karşılaştır
+// Play a recording start to finish with no window and compare the final state with it
+static int runReplayHeadless(const HeadlessOptions& options) {
+    Replay replay;
+    if (!replay.load(options.replayPath)) {
+        std::cerr << "Failed to load replay: " << options.replayPath << std::endl;
+        return 1;
+    }
+
+    GameSimulation sim;
+    if (options.particleCapacity > 0) {
+        sim.particles.setCapacity((size_t)options.particleCapacity);
+    }
+    sim.logEvents = false;
+    sim.seed(replay.seed);
+    std::unique_ptr<JobSystem> jobs = makeJobSystem(options);
+    sim.jobs = jobs.get();
+
+    ReplayPlayer player(replay);
+    InputAction action;
+    auto startTime = std::chrono::steady_clock::now();
+
+    while (!player.finished(sim.stepIndex())) {
+        while (player.next(sim.stepIndex(), action)) {
+            sim.applyInput(action);
+        }
+        sim.step(SIM_DT);
+        sim.soundEvents.clear();
+    }
+
+    auto endTime = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(endTime - startTime).count();
+    uint64_t checksum = simulationChecksum(sim);
+    bool match = checksum == replay.finalChecksum;
+
+    std::cout << "Replay: " << replay.totalSteps << " steps, " << replay.events.size() << " inputs in "
+              << seconds * 1000.0 << " ms (" << (seconds > 0.0 ? replay.totalSteps * SIM_DT / seconds : 0.0)
+              << "x real time)" << std::endl;
+    std::cout << "Final: score " << sim.score << " | level " << sim.level << " | health " << sim.health
+              << " | checksum " << (match ? "MATCH" : "MISMATCH") << std::endl;
+    return match ? 0 : 2;
+}
+
+// Yön tuşu olaylarını kayıt üzerinden uygula ve her adımdan sonra oyuncu konumunu beklenenle karşılaştır
+// Apply direction key events through a recording and compare the player position with the expected one after every step
+static int runInputCheck() {
+    const uint64_t TAP_STEP = 1;
+    const uint64_t PRESS_STEP = 2;
+    const uint64_t RELEASE_STEP = 5;
+    Replay replay;
+    replay.seed = 1;
+    replay.events = {
+        { 0, InputAction::Start },
+        // Aynı adımdan önce basılıp bırakılan dokunuş => // A tap pressed and released before the same step
+        { TAP_STEP, InputAction::LeftDown },
+        { TAP_STEP, InputAction::LeftUp },
+        { PRESS_STEP, InputAction::RightDown },
+        { RELEASE_STEP, InputAction::RightUp },
+    };
+    replay.totalSteps = RELEASE_STEP + 2;
+
+    uint64_t checksums[2] = {};
+    int failures = 0;
+    for (uint64_t& checksum : checksums) {
+        GameSimulation sim;
+        sim.logEvents = false;
+        sim.seed(replay.seed);
+        ReplayPlayer player(replay);
+        InputAction action;
+        float expected = 0.0f;
+        while (!player.finished(sim.stepIndex())) {
+            const uint64_t step = sim.stepIndex();
+            while (player.next(step, action)) {
+                sim.applyInput(action);
+            }
+            // Basışın ilk adımı tam hız, basılı tutulan adımlar HELD_MOVE_SCALE
+            // The first step of a press is full speed, held steps are HELD_MOVE_SCALE
+            if (step == TAP_STEP) {
+                expected -= sim.playerSpeed;
+            } else if (step == PRESS_STEP) {
+                expected += sim.playerSpeed;
+            } else if (step > PRESS_STEP && step < RELEASE_STEP) {
+                expected += sim.playerSpeed * HELD_MOVE_SCALE;
+            }
+            sim.step(SIM_DT);
+            sim.soundEvents.clear();
+            if (std::fabs(sim.playerX - expected) > 1e-5f) {
+                std::cerr << "Input check: step " << step << " player at " << sim.playerX
+                          << ", expected " << expected << std::endl;
+                failures++;
+            }
+        }
+        checksum = simulationChecksum(sim);
+    }
+    if (checksums[0] != checksums[1]) {
+        std::cerr << "Input check: replaying the same inputs gave a different checksum" << std::endl;
+        failures++;
+    }
+    std::cout << "Input check: " << (failures == 0 ? "PASS" : "FAIL") << std::endl;
+    return failures == 0 ? 0 : 1;
+}
+
+int runHeadless(const HeadlessOptions& options) {
+    if (options.inputCheck) {
+        return runInputCheck();
+    }
+    if (!options.replayPath.empty()) {
+        return runReplayHeadless(options);
+    }
+
+    GameSimulation sim;
+    uint64_t seed = options.hasSeed ? options.seed : makeRandomSeed();
+    sim.seed(seed);
+    if (options.particleCapacity > 0) {
+        sim.particles.setCapacity((size_t)options.particleCapacity);
+    }
+    sim.logEvents = false;
+    std::unique_ptr<JobSystem> jobs = makeJobSystem(options);
+    sim.jobs = jobs.get();
+
+    // Trace istendiyse her adım bir "kare" sayılır => // When tracing, every step counts as one "frame"
+    Profiler profiler;
+    if (!options.tracePath.empty()) {
+        sim.profiler = &profiler;
+        profiler.enableTrace(true);
+    }
+
+    // Tek girdi otomatik ENTER'dır; kayıt isteniyorsa adımıyla saklanır
+    // The only input is the automatic ENTER; it is stored with its step when recording
+    Replay recording;
+    recording.seed = seed;
+    auto pressStart = [&]() {
+        if (!options.recordPath.empty()) {
+            recording.events.push_back({ sim.stepIndex(), InputAction::Start });
+        }
+        sim.applyInput(InputAction::Start);
+    };
+    pressStart();
+
+    long long soundEventCount = 0;
+    int gamesPlayed = 1;
+    int bestScore = 0;
+    int bestLevel = 1;
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    for (long long frame = 0; frame < options.frames; frame++) {
+        if (sim.profiler) {
+            profiler.collect();
+        }
+        sim.step(SIM_DT);
+
+        // Ses yok; olayları sadece say => // No audio; just count the events
+        soundEventCount += sim.soundEvents.size();
+        sim.soundEvents.clear();
+
+        // Oyun bittiğinde ENTER'a basılmış gibi yeniden başlat => // Restart as if ENTER was pressed on game over
+        if (sim.gameOver) {
+            bestScore = std::max(bestScore, sim.score);
+            bestLevel = std::max(bestLevel, sim.level);
+            pressStart();
+            gamesPlayed++;
+        }
+    }
+
+    auto endTime = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(endTime - startTime).count();
+
+    bestScore = std::max(bestScore, sim.score);
+    bestLevel = std::max(bestLevel, sim.level);
+
+    if (sim.profiler) {
+        profiler.collect();
+        std::cout << "Step p50/p99 (us): particles " << profiler.percentileMs(ProfileStage::Particles, 0.5f) * 1000.0f
+                  << "/" << profiler.percentileMs(ProfileStage::Particles, 0.99f) * 1000.0f
+                  << " | blocks " << profiler.percentileMs(ProfileStage::Blocks, 0.5f) * 1000.0f
+                  << "/" << profiler.percentileMs(ProfileStage::Blocks, 0.99f) * 1000.0f << std::endl;
+        if (!profiler.writeChromeTrace(options.tracePath)) {
+            std::cerr << "Failed to write trace: " << options.tracePath << std::endl;
+        }
+    }
+
+    if (!options.recordPath.empty()) {
+        recording.totalSteps = sim.stepIndex();
+        recording.finalChecksum = simulationChecksum(sim);
+        if (!recording.save(options.recordPath)) {
+            std::cerr << "Failed to write replay: " << options.recordPath << std::endl;
+        }
+    }
+
+    std::cout << "Headless run: " << options.frames << " steps in " << seconds * 1000.0 << " ms"
+              << " (seed " << seed << ")" << std::endl;
+    std::cout << "Throughput: " << (seconds > 0.0 ? options.frames / seconds : 0.0) << " steps/s, "
+              << (options.frames > 0 ? seconds * 1e9 / options.frames : 0.0) << " ns/step" << std::endl;
+    std::cout << "Simulated time: " << options.frames * SIM_DT << " s" << std::endl;
+    std::cout << "Games: " << gamesPlayed << " | Best score: " << bestScore << " | Best level: " << bestLevel
+              << " | Sound events: " << soundEventCount << std::endl;
+    std::cout << "Particles: " << sim.particles.size() << "/" << sim.particles.capacity()
+              << " | Evicted: " << sim.particles.evictedCount()
+              << " | Dropped: " << sim.particles.droppedCount()
+              << " | Threads: " << (jobs ? jobs->workerCount() + 1 : 1) << std::endl;
+    return 0;
+}
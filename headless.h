@@ -0,0 +1,32 @@
+#pragma once
+
+// Ekransız (headless) çalışma modu: pencere, GL ve ses olmadan simülasyonu koşturur.
+// Headless mode: runs the simulation with no window, GL or audio.
+//   myGame --headless --frames N [--particles CAPACITY] [--seed SEED]
+//   myGame --headless --frames N --record FILE  (otomatik yeniden başlatmalar dahil kaydet)
+//   myGame --headless --replay FILE   (kaydı olabildiğince hızlı tekrar et ve doğrula)
+//   ... --trace FILE.json             (aşama sürelerini Chrome/Perfetto trace olarak yaz)
+//   ... --threads N                   (parçacık güncellemesini N iş parçacığına böl; 0 = tüm çekirdekler)
+//   myGame --headless --input-check   (yön tuşu senaryolarını kayıttan oynat ve hareketi doğrula)
+
+#include <cstdint>
+#include <string>
+
+struct HeadlessOptions {
+    bool enabled = false;   // --headless verildi mi
+    long long frames = 36000; // Çalıştırılacak simülasyon adımı sayısı (varsayılan: 10 dakikalık oyun)
+    long long particleCapacity = 0; // 0 = MAX_PARTICLES
+    bool hasSeed = false;   // --seed verilmediyse rastgele tohum seçilir ve yazdırılır
+    uint64_t seed = 0;
+    std::string replayPath; // --replay: boş değilse kayıt tekrar edilir
+    std::string recordPath; // --record: koşunun girdileri bu dosyaya yazılır
+    std::string tracePath;  // --trace: simülasyon aşamaları Chrome trace JSON olarak yazılır
+    int threads = 1;        // --threads: 1 = iş sistemi yok, 0 = tüm çekirdekler; sonuç her durumda aynı
+    bool inputCheck = false; // --input-check: basılı tuş / dokunuş hareketini doğrula ve çık
+};
+
+// Komut satırını oku; --headless istendiyse true döner => // Parse the command line; returns true if --headless was requested
+bool parseHeadlessArgs(int argc, char** argv, HeadlessOptions& options);
+
+// Simülasyonu mümkün olan en yüksek hızda çalıştır ve özet yazdır => // Run the simulation flat out and print a summary
+int runHeadless(const HeadlessOptions& options);
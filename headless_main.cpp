@@ -0,0 +1,10 @@
+// GLFW/GLEW/SFML olmadan derlenen headless giriş noktası (CI, soak testleri, benchmark)
+// Headless entry point built without GLFW/GLEW/SFML (CI, soak tests, benchmarks)
+#include "headless.h"
+
+int main(int argc, char** argv) {
+    HeadlessOptions options;
+    parseHeadlessArgs(argc, argv, options);
+    options.enabled = true;
+    return runHeadless(options);
+}
@@ -0,0 +1,60 @@
+#include "hud.h"
+
+static HudScreen screenOf(const RenderSnapshot& view) {
+    if (!view.gameStarted) {
+        return HudScreen::Welcome;
+    } else if (view.gameOver) {
+        return HudScreen::GameOver;
+    } else if (view.isPaused) {
+        return HudScreen::Paused;
+    }
+    return HudScreen::Playing;
+}
+
+unsigned HudModel::update(const RenderSnapshot& view) {
+    unsigned changed = 0;
+    HudScreen newScreen = screenOf(view);
+
+    if (!initialized || newScreen != currentScreen) {
+        currentScreen = newScreen;
+        changed |= HUD_SCREEN;
+    }
+    if (!initialized || view.score != score) {
+        score = view.score;
+        scoreText = "Score: " + std::to_string(score);
+        changed |= HUD_SCORE;
+    }
+    if (!initialized || view.level != level) {
+        level = view.level;
+        levelText = "Level: " + std::to_string(level);
+        changed |= HUD_LEVEL;
+    }
+    if (!initialized || view.health != health) {
+        health = view.health;
+        healthText = "Health: " + std::to_string(health);
+        changed |= HUD_HEALTH;
+    }
+    initialized = true;
+
+    // Başlık yalnızca ekran değişince yeniden kurulur; oyun sonu skoru o anda sabittir
+    // The title is only rebuilt on a screen change; the game-over score is fixed by then
+    if (changed & HUD_SCREEN) {
+        switch (currentScreen) {
+            case HudScreen::Welcome:
+                titleText = "Welcome to the Game! Press ENTER.";
+                break;
+            case HudScreen::Playing:
+                titleText = "Avoidance Game";
+                break;
+            case HudScreen::Paused:
+                titleText = "PAUSED | Press P to Resume";
+                break;
+            case HudScreen::GameOver:
+                titleText = "Game Over! Score: " + std::to_string(score) + " | Press ENTER to Restart";
+                break;
+        }
+        changed |= HUD_TITLE;
+    }
+
+    return changed;
+}
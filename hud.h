@@ -0,0 +1,56 @@
+#pragma once
+
+// HUD / pencere başlığı durum katmanı: simülasyon görüntüsünden gösterilen değerleri okur,
+// neyin değiştiğini bit maskesiyle bildirir ve metinleri yalnızca değiştiklerinde
+// yeniden oluşturur. GL bağımlılığı yoktur.
+// HUD / window title state layer: reads the displayed values from a simulation snapshot,
+// reports what changed as a bit mask and rebuilds strings only when they change.
+// No GL dependency.
+//
+// Pencere başlığı yalnızca ekran değişince (karşılama, oyun, duraklatma, oyun sonu)
+// güncellenir; skor, seviye ve can pencere içinde önbellekli metinle çizilir.
+// The window title only changes with the screen (welcome, playing, paused, game
+// over); score, level and health are drawn in-window through cached text.
+
+#include <string>
+#include "sim_thread.h"
+
+enum class HudScreen {
+    Welcome,
+    Playing,
+    Paused,
+    GameOver
+};
+
+// update() dönüş bitleri => // Bits returned by update()
+const unsigned HUD_SCREEN = 1u << 0;
+const unsigned HUD_SCORE = 1u << 1;
+const unsigned HUD_LEVEL = 1u << 2;
+const unsigned HUD_HEALTH = 1u << 3;
+const unsigned HUD_TITLE = 1u << 4; // title() metni değişti
+
+class HudModel {
+public:
+    // Görüntünün değerlerini al; değişen alanların bit maskesini döner
+    // Take the snapshot's values; returns a bit mask of the changed fields
+    unsigned update(const RenderSnapshot& view);
+
+    HudScreen screen() const { return currentScreen; }
+    const std::string& title() const { return titleText; }
+    const std::string& scoreLabel() const { return scoreText; }
+    const std::string& levelLabel() const { return levelText; }
+    const std::string& healthLabel() const { return healthText; }
+
+private:
+    // İlk update() her şeyi kirli sayar => // The first update() treats everything as dirty
+    bool initialized = false;
+    HudScreen currentScreen = HudScreen::Welcome;
+    int score = 0;
+    int level = 0;
+    int health = 0;
+
+    std::string titleText;
+    std::string scoreText;
+    std::string levelText;
+    std::string healthText;
+};
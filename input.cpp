@@ -0,0 +1,68 @@
+#include "input.h"
+#include <algorithm>
+#include "profiler.h"
+
+static_assert((InputLatency::PENDING_CAPACITY & (InputLatency::PENDING_CAPACITY - 1)) == 0,
+              "pending capacity must be a power of two");
+
+InputLatency::InputLatency() {
+    samples.reserve(SAMPLE_CAPACITY);
+    scratch.reserve(SAMPLE_CAPACITY);
+}
+
+InputEvent InputLatency::stamp(InputAction action) {
+    InputEvent event{ action, nextSerial++, Profiler::now() };
+    if (nextSerial == 0) {
+        nextSerial = 1; // 0 ayrılmış => // 0 is reserved
+    }
+    pending[event.serial & (PENDING_CAPACITY - 1)] = event.timeNs;
+    return event;
+}
+
+void InputLatency::dropped(const InputEvent& event) {
+    pending[event.serial & (PENDING_CAPACITY - 1)] = 0;
+}
+
+void InputLatency::presented(uint32_t appliedSerial, uint64_t presentNs, Profiler* profiler) {
+    uint32_t count = appliedSerial - presentedSerial;
+    if (appliedSerial == 0 || count == 0) {
+        return;
+    }
+    // Çok geride kaldıysak yalnızca halkada hâlâ duran olaylar ölçülür
+    // If we fell far behind, only the events still held in the ring are measured
+    if (count > PENDING_CAPACITY) {
+        presentedSerial = appliedSerial - (uint32_t)PENDING_CAPACITY;
+    }
+    while (presentedSerial != appliedSerial) {
+        presentedSerial++;
+        if (presentedSerial == 0) {
+            continue;
+        }
+        uint64_t& submitted = pending[presentedSerial & (PENDING_CAPACITY - 1)];
+        if (submitted == 0 || submitted > presentNs) {
+            continue;
+        }
+        if (profiler) {
+            profiler->record(ProfileStage::InputToPhoton, submitted, presentNs);
+        }
+        float ms = (presentNs - submitted) / 1.0e6f;
+        if (samples.size() < SAMPLE_CAPACITY) {
+            samples.push_back(ms);
+        } else {
+            samples[samplePos] = ms;
+        }
+        samplePos = (samplePos + 1) % SAMPLE_CAPACITY;
+        total++;
+        submitted = 0;
+    }
+}
+
+float InputLatency::percentileMs(float percentile) const {
+    if (samples.empty()) {
+        return 0.0f;
+    }
+    scratch.assign(samples.begin(), samples.end());
+    size_t k = std::min(samples.size() - 1, (size_t)(percentile * (samples.size() - 1) + 0.5f));
+    std::nth_element(scratch.begin(), scratch.begin() + k, scratch.end());
+    return scratch[k];
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+// Zaman damgalı girdi olayları ve girdiden ekrana (input-to-photon) gecikme ölçümü.
+// Timestamped input events and input-to-photon latency measurement.
+//
+// Her tuş olayı ön yüzde bir seri numarası ve Profiler::now() zamanı alır, kuyrukla
+// simülasyona gider ve bir adımın başında uygulanır. Simülasyon uyguladığı son seri
+// numarasını görüntüye yazar; o görüntü ekrana basıldığında (glfwSwapBuffers döndüğünde)
+// aradaki tüm olaylar için gecikme örneği kaydedilir.
+// Every key event gets a serial number and a Profiler::now() time in the front end,
+// travels to the simulation through the queue and is applied at the start of a step.
+// The simulation writes the last serial it applied into the snapshot; when that
+// snapshot is presented (glfwSwapBuffers returns) a latency sample is recorded for
+// every event in between.
+//
+// Yaklaşımlar: olay zamanı GLFW geri çağrısının zamanıdır (işletim sistemi olayı biraz
+// daha eskidir) ve "foton" zamanı takasın dönüşüdür (ekran tazelemesi biraz sonradır).
+// Approximations: the event time is when the GLFW callback runs (the OS event is a bit
+// older) and "photon" time is when the swap returns (the scanout is a bit later).
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "game_simulation.h"
+
+class Profiler;
+
+struct InputEvent {
+    InputAction action;
+    uint32_t serial;  // 1'den başlar; 0 "olay yok" demektir => // Starts at 1; 0 means "no event"
+    uint64_t timeNs;  // Profiler::now()
+};
+
+// Yalnızca ön yüz (çizim) iş parçacığı kullanır => // Used by the front-end (render) thread only
+class InputLatency {
+public:
+    static const size_t PENDING_CAPACITY = 256; // İkinin kuvveti; girdi kuyruğundan büyük olmalı
+    static const size_t SAMPLE_CAPACITY = 512;  // Son bu kadar örnekten yüzdelik => // Percentiles over this many recent samples
+
+    InputLatency();
+
+    // Yeni bir olayı numarala ve zaman damgası vur => // Number and timestamp a new event
+    InputEvent stamp(InputAction action);
+    // Kuyruğa giremeyen olay örnek üretmesin => // An event that never made it into the queue yields no sample
+    void dropped(const InputEvent& event);
+
+    // appliedSerial'e kadar uygulanmış olayları içeren kare presentNs'de ekrana basıldı
+    // A frame containing the events applied up to appliedSerial was presented at presentNs
+    void presented(uint32_t appliedSerial, uint64_t presentNs, Profiler* profiler);
+
+    float percentileMs(float percentile) const;
+    size_t sampleCount() const { return samples.size(); }
+    uint64_t totalSamples() const { return total; }
+
+private:
+    uint32_t nextSerial = 1;
+    uint32_t presentedSerial = 0;
+    uint64_t pending[PENDING_CAPACITY] = {}; // Seri numarasıyla indekslenir; 0 = örnek yok
+
+    std::vector<float> samples; // Halka, ms => // Ring, ms
+    size_t samplePos = 0;
+    uint64_t total = 0;
+    mutable std::vector<float> scratch;
+};
@@ -0,0 +1,150 @@
+#include "job_system.h"
+#include <algorithm>
+
+JobSystem::JobSystem(int workers) {
+    if (workers < 0) {
+        unsigned cores = std::thread::hardware_concurrency();
+        workers = cores > 1 ? (int)cores - 1 : 0;
+    }
+    workers = std::min(workers, (int)MAX_JOB_WORKERS);
+    for (int i = 0; i < workers; i++) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for (int i = 0; i < workers; i++) {
+        threads.emplace_back([this, i] { workerLoop((size_t)i); });
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        stopping.store(true, std::memory_order_release);
+    }
+    wake.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+void JobSystem::runTask(const Task& task) {
+    Batch& batch = *task.batch;
+    size_t begin = task.chunk * batch.grain;
+    size_t end = std::min(begin + batch.grain, batch.count);
+    batch.run(batch.context, begin, end);
+    // Son azaltmadan sonra batch çağıranın yığınından kalkabilir; ona dokunma
+    // After the last decrement the batch may leave the caller's stack; do not touch it
+    batch.pending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool JobSystem::popBack(Queue& queue, Task& task) {
+    std::lock_guard<std::mutex> guard(queue.lock);
+    if (queue.head == queue.tail) {
+        return false;
+    }
+    task = queue.tasks[--queue.tail & (QUEUE_CAPACITY - 1)];
+    queued.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool JobSystem::stealFront(Queue& queue, Task& task) {
+    std::lock_guard<std::mutex> guard(queue.lock);
+    if (queue.head == queue.tail) {
+        return false;
+    }
+    task = queue.tasks[queue.head++ & (QUEUE_CAPACITY - 1)];
+    queued.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool JobSystem::stealOwn(Queue& queue, const Batch& batch, Task& task) {
+    std::lock_guard<std::mutex> guard(queue.lock);
+    for (size_t i = queue.head; i != queue.tail; i++) {
+        Task& candidate = queue.tasks[i & (QUEUE_CAPACITY - 1)];
+        if (candidate.batch == &batch) {
+            // Öndeki görevi boşalan yere taşı ve önü ilerlet; sıra yalnızca zamanlamayı etkiler
+            // Move the front task into the freed slot and advance the front; order only affects timing
+            task = candidate;
+            candidate = queue.tasks[queue.head & (QUEUE_CAPACITY - 1)];
+            queue.head++;
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool JobSystem::findTask(size_t start, Task& task) {
+    for (size_t k = 0; k < queues.size(); k++) {
+        if (stealFront(*queues[(start + k) % queues.size()], task)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobSystem::runBatch(Batch& batch, size_t chunks) {
+    // Parça 0 çağıranda kalır; gerisi sırayla kuyruklara ardışık gruplar halinde dağılır
+    // Chunk 0 stays with the caller; the rest go to the queues in consecutive groups
+    const size_t queueCount = queues.size();
+    const size_t first = nextQueue.fetch_add(1, std::memory_order_relaxed) % queueCount;
+    const size_t perQueue = (chunks - 1 + queueCount - 1) / queueCount;
+    size_t chunk = 1;
+    for (size_t k = 0; k < queueCount && chunk < chunks; k++) {
+        Queue& queue = *queues[(first + k) % queueCount];
+        size_t groupEnd = std::min(chunk + perQueue, chunks);
+        // Sahibi arkadan aldığı için ters sırayla it; işçi grubunu baştan sona işler
+        // Push in reverse because the owner pops from the back; it works through its group in order
+        size_t unpushed = groupEnd;
+        {
+            std::lock_guard<std::mutex> guard(queue.lock);
+            while (unpushed > chunk && queue.tail - queue.head < QUEUE_CAPACITY) {
+                queue.tasks[queue.tail++ & (QUEUE_CAPACITY - 1)] = { &batch, --unpushed };
+                queued.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        // Dolu kuyruğa sığmayan parçaları çağıran hemen çalıştırır => // Chunks that did not fit a full queue run on the caller right away
+        for (size_t c = chunk; c < unpushed; c++) {
+            runTask({ &batch, c });
+        }
+        chunk = groupEnd;
+    }
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+    }
+    wake.notify_all();
+
+    runTask({ &batch, 0 });
+
+    // Bitene kadar yalnızca bu batch'in parçalarıyla yardım et; kalanlar işçilerde sürerken bekle
+    // Help with this batch's chunks only until done; wait while the rest finish on the workers
+    Task task;
+    while (batch.pending.load(std::memory_order_acquire) != 0) {
+        bool found = false;
+        for (size_t k = 0; k < queueCount && !found; k++) {
+            found = stealOwn(*queues[(first + k) % queueCount], batch, task);
+        }
+        if (found) {
+            runTask(task);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::workerLoop(size_t index) {
+    Queue& own = *queues[index];
+    Task task;
+    while (true) {
+        if (popBack(own, task) || findTask(index + 1, task)) {
+            runTask(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> guard(sleepLock);
+        wake.wait(guard, [this] {
+            return stopping.load(std::memory_order_acquire) || queued.load(std::memory_order_relaxed) != 0;
+        });
+        if (stopping.load(std::memory_order_acquire)) {
+            return;
+        }
+    }
+}
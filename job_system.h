@@ -0,0 +1,125 @@
+#pragma once
+
+// Küçük iş çalan (work-stealing) iş sistemi: aralıklar üzerinde paralel döngü.
+// Small work-stealing job system: parallel-for over index ranges.
+//
+// Her işçinin kendi kuyruğu (deque) vardır; sahibi arkadan alır, boşta kalan
+// işçiler başkalarının önünden çalar. parallelFor() aralığı sabit boyutlu
+// parçalara böler, parçaları kuyruklara dağıtır ve bitene kadar çağıran iş
+// parçacığında da parça çalıştırır. Yığında tutulan parçalarla hiç heap ayrılmaz.
+// Every worker has its own deque; the owner pops from the back and idle workers
+// steal from the front of the others. parallelFor() cuts the range into fixed-size
+// chunks, spreads them over the deques and also runs chunks on the calling thread
+// until all are done. Chunks live on the caller's stack, so nothing is allocated.
+//
+// Parça sınırları yalnızca count ve grain'e bağlıdır, işçi sayısına değil. Her
+// parça yalnızca kendi indekslerine yazarsa sonuç, işçi sayısından ve zamanlamadan
+// bağımsız olarak tek iş parçacıklı çalışmayla bit bit aynıdır (replay'ler için).
+// Chunk bounds depend only on count and grain, not on the worker count. As long as
+// each chunk writes only its own indices, the result is bit-identical to a
+// single-threaded run whatever the worker count or timing (for replays).
+//
+// Birden çok iş parçacığı (ör. simülasyon ve çizim) aynı anda parallelFor çağırabilir.
+// Bekleyen çağıran yalnızca kendi parçalarına yardım eder, başka çağıranın işini almaz;
+// çizim iş parçacığı simülasyon parçacıklarını çalıştırıp kareyi geciktirmez, tersi de olmaz.
+// İşçiler her çağıranın parçalarını çalıştırır.
+// Several threads (e.g. simulation and render) may call parallelFor at the same time.
+// A waiting caller only helps with its own chunks and never takes another caller's work,
+// so the render thread does not stall a frame on simulation particles and vice versa.
+// Workers run chunks from every caller.
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+const unsigned MAX_JOB_WORKERS = 15; // Çağıranla birlikte 16 çekirdek => // 16 cores together with the caller
+
+class JobSystem {
+public:
+    // workers: arka plan işçi sayısı; negatifse çekirdek sayısı - 1 (en fazla MAX_JOB_WORKERS)
+    // workers: number of background workers; when negative, core count - 1 (at most MAX_JOB_WORKERS)
+    explicit JobSystem(int workers = -1);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    unsigned workerCount() const { return (unsigned)threads.size(); }
+
+    // [0, count) aralığını grain boyutlu parçalarla fn(begin, end) olarak çalıştır ve bekle
+    // Run fn(begin, end) over [0, count) in chunks of grain and wait for all of them
+    template <typename Fn>
+    void parallelFor(size_t count, size_t grain, Fn&& fn) {
+        if (count == 0) {
+            return;
+        }
+        if (grain == 0) {
+            grain = 1;
+        }
+        const size_t chunks = (count + grain - 1) / grain;
+        if (chunks == 1 || threads.empty()) {
+            fn((size_t)0, count);
+            return;
+        }
+        Batch batch;
+        batch.run = &invoke<typename std::remove_reference<Fn>::type>;
+        batch.context = (void*)&fn;
+        batch.count = count;
+        batch.grain = grain;
+        batch.pending.store(chunks, std::memory_order_relaxed);
+        runBatch(batch, chunks);
+    }
+
+private:
+    struct Batch {
+        void (*run)(void* context, size_t begin, size_t end);
+        void* context;
+        size_t count;
+        size_t grain;
+        std::atomic<size_t> pending; // Bitmemiş parça sayısı => // Chunks not finished yet
+    };
+
+    struct Task {
+        Batch* batch;
+        size_t chunk;
+    };
+
+    // Sabit kapasiteli halka; kilit kısa tutulur ve parçalar kaba olduğundan çekişme düşüktür
+    // Fixed-capacity ring; the lock is held briefly and chunks are coarse, so contention is low
+    static const size_t QUEUE_CAPACITY = 256; // 2'nin kuvveti olmalı => // must be a power of two
+    static_assert((QUEUE_CAPACITY & (QUEUE_CAPACITY - 1)) == 0, "queue capacity must be a power of two");
+    struct alignas(64) Queue {
+        std::mutex lock;
+        Task tasks[QUEUE_CAPACITY];
+        size_t head = 0; // Hırsızlar buradan alır => // Thieves take from here
+        size_t tail = 0; // Sahibi buradan alır => // The owner takes from here
+    };
+
+    template <typename Fn>
+    static void invoke(void* context, size_t begin, size_t end) {
+        (*static_cast<Fn*>(context))(begin, end);
+    }
+
+    void runBatch(Batch& batch, size_t chunks);
+    static void runTask(const Task& task);
+    bool popBack(Queue& queue, Task& task);
+    bool stealFront(Queue& queue, Task& task);
+    // Kuyrukta bu batch'e ait bir parça varsa al => // Take a chunk of this batch if the queue holds one
+    bool stealOwn(Queue& queue, const Batch& batch, Task& task);
+    // Herhangi bir kuyruktan iş bul; start'tan başlayarak dolaş => // Find work in any queue, scanning from start
+    bool findTask(size_t start, Task& task);
+    void workerLoop(size_t index);
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> threads;
+    std::atomic<size_t> queued{0};
+    std::atomic<size_t> nextQueue{0};
+    std::atomic<bool> stopping{false};
+    std::mutex sleepLock;
+    std::condition_variable wake;
+};
@@ -4,717 +4,283 @@
 #include <SFML/Audio.hpp> // Ses için ekle
 #include <iostream> // Giriş-çıkış akışı için
 #include <vector> // Vektör işlemleri için
-#include <cstdlib> // Rastgele sayı üretimi için
-#include <ctime> // Zaman için
-#include <sstream> // String akışı için
+#include <cstdlib>
 #include <filesystem> // Dizin işlemleri için
 #include <optional> // İsteğe bağlı tip için
-#include <map> // std::map için
 #include <memory>
 #include <algorithm>
-
-// Ses arabellek nesnelerini tanımla
-sf::SoundBuffer collisionBuffer;
-sf::SoundBuffer powerUpBuffer;
-sf::SoundBuffer levelUpBuffer;
-sf::SoundBuffer gameOverBuffer;
-
-// İlk arabellekle ses nesnelerini tanımla
-sf::Sound collisionSound(collisionBuffer);
-sf::Sound powerUpSound(powerUpBuffer);
-sf::Sound levelUpSound(levelUpBuffer);
-sf::Sound gameOverSound(gameOverBuffer);
+#include <cmath>
+#include <chrono>
+#include "game_simulation.h"
+#include "headless.h"
+#include "particle_renderer.h"
+#include "sprite_renderer.h"
+#include "trig_tables.h"
+#include "text_renderer.h"
+#include "hud.h"
+#include "replay.h"
+#include "profiler.h"
+#include "asset_loader.h"
+#include "asset_archive.h"
+#include "voice_pool.h"
+#include "sim_thread.h"
+#include "job_system.h"
+#include "input.h"
+#include "frame_pacer.h"
+#include "gl_core_backend.h"
+#include "gl_immediate_backend.h"
+
+// assets.pak bulunursa sesler eşlenmiş arşivden okunur; müzik çalarken eşleme açık kalmalı
+// If assets.pak is found the sounds are read from the mapped archive; the mapping must outlive the music
+AssetArchive assetArchive;
+
+// Efekt klipleri arka planda mono 16-bit'e çözülür; ilk çalındıklarında hazır olmaları beklenir
+// Effect clips are decoded to mono 16-bit in the background; each one is waited for at first play
+SoundClip collisionSound;
+SoundClip powerUpSound;
+SoundClip levelUpSound;
+SoundClip gameOverSound;
+// Efektler sabit sayıda sesle çalınır; kliplerden sonra tanımlı, önce o yok edilir
+// Effects play on a fixed set of voices; declared after the clips so it is destroyed first
+VoicePool voicePool;
+int collisionClip, powerUpClip, levelUpClip, gameOverClip;
 sf::Music sigma; // Sigma müziğini koru
 
-float playerX = 0.0f; // Oyuncu pozisyonu (Yatay)
-float playerSpeed = 0.07f;
-float blockSpeed = 0.01f; // İlk blok hızı (Seviye ile artar)
-int score = 0;
-int health = 3;
-int level = 1;  
-bool gameOver = false;
-bool gameStarted = false;
-float backgroundColor = 0.0f;
-bool colorIncreasing = true; // Arka plan renk animasyon yönü
-
 // Ses kontrolü
 bool isMuted = false; 
 float previousVolume = 30.0f;  // Sesi açmak için önceki sesi sakla
 
-// Oyun durumu
-bool isPaused = false;
-
-// Geçiş efektleri
-bool fadeInEffect = false;
-bool fadeOutEffect = false;
-float fadeAlpha = 1.0f;
-
-const int SCORE_PER_LEVEL = 20; // Seviye atlamak için gereken puan
-const float LEVEL_SPEED_INCREASE = 0.0003f; // Seviye başına hız artışı
-const float NORMAL_SPEED_INCREASE = 0.00003f; // Puan başına küçük hız artışı
-const int MAX_BLOCKS = 10; // Maksimum blok sayısı
-
-struct Block {
-    float x, y;
-    int shape;  // 0 = kare, 1 = üçgen, 2 = daire
-    float r, g, b; // Blok rengi
-    int movementPattern; // 0 = doğrusal, 1 = zigzag, 2 = dairesel
-    float movementTimer; // Hareket döngülerini takip için
-    float originX; // Dairesel/zigzag desenler için orijinal X pozisyonu
-};
-
-struct PowerUp {
-    float x, y;
-    int type;  // 1 = hız, 2 = blok sıfırlama, 3 = görünmezlik, 4 = zaman yavaşlatma, 5 = kalkan, 6 = ekstra can
-    float duration;  // Güç-artırma süresi
-};
-
-// Zaman yavaşlatma güç-artırımını işle
-bool hasTimeSlow = false;
-float timeSlowTimer = 0.0f;
-float timeSlowFactor = 1.0f;
-
-// Kalkan güç-artırımını işle
-bool hasShield = false;
-float shieldTimer = 0.0f;
-
-// Font dokusu ve karakter bilgisi
-struct Character {
-    float advanceX;    // İlerleme X ofseti
-    float advanceY;    // İlerleme Y ofseti
-    float width;       // Karakter genişliği
-    float height;      // Karakter yüksekliği
-    float texX;        // Doku X ofseti
-    float texY;        // Doku Y ofseti
-    float texWidth;    // Doku genişliği
-    float texHeight;   // Doku yüksekliği
-};
-
-// Font dokusu ve karakterleri
-GLuint fontTextureID = 0;
-std::map<char, Character> characters;
-bool fontLoaded = false;
-
-// Font dokusu boyutu
-const int FONT_TEXTURE_WIDTH = 512;
-const int FONT_TEXTURE_HEIGHT = 512;
-
-std::vector<Block> blocks;
-std::vector<PowerUp> powerUps;
-bool isInvisible = false; // Görünmezlik durumu
-float invisibilityTimer = 0.0f; 
-
-// Güç-artırma değişkenleri
-bool hasSpeedBoost = false;
-float speedBoostTimer = 0.0f;
-float originalPlayerSpeed = 0.05f;
-bool hasBlockReset = false;
-float blockResetTimer = 0.0f;
-
-// Parçacık yapısı
-struct Particle {
-    float x, y;          // Pozisyon
-    float vx, vy;        // Hız vektörü
-    float r, g, b, a;    // Renk (kırmızı, yeşil, mavi, alfa)
-    float lifetime;      // Ömür
-    float size;          // Boyut
-    float rotation;      // Dönüş açısı (derece)
-    float rotationSpeed; // Dönüş hızı
-};
-
-// Parçacık sistemi için global değişkenler
-std::vector<Particle> particles;
-const int MAX_PARTICLES = 200;
-
-// Parçacık oluşturma fonksiyonu
-void createParticle(float x, float y, float vx, float vy, 
-                   float r, float g, float b, float a,
-                   float lifetime, float size, float rotation = 0.0f, float rotationSpeed = 0.0f) {
-    if (particles.size() < MAX_PARTICLES) {
-        particles.push_back({
-            x, y, vx, vy, r, g, b, a, lifetime, size, rotation, rotationSpeed
-        });
-    }
+// Aşağıdakiler main() içinde headless dalından sonra kurulur; headless kendi simülasyonunu kurar
+// The objects below are built in main() after the headless branch; headless builds its own simulation
+
+// Parçacık güncellemesi ve köşe doldurma tüm çekirdeklere bölünür; simülasyon ve çizim paylaşır
+// Particle updates and vertex filling are split over all cores; shared by simulation and render
+std::unique_ptr<JobSystem> jobs;
+
+// Tüm oyun durumu simülasyonda tutulur => // All gameplay state lives in the simulation
+std::unique_ptr<GameSimulation> game;
+// Simülasyon kendi iş parçacığında çalışır; çizim yalnızca yayınlanan görüntüleri okur
+// The simulation runs on its own thread; rendering only reads the published snapshots
+std::unique_ptr<SimulationThread> simThread;
+
+// --record: uygulanan girdiler adım indeksleriyle kaydedilir => // Applied inputs are recorded with step indices
+std::string recordPath;
+Replay recording;
+// --replay: girdiler klavye yerine kayıttan gelir => // Inputs come from the recording instead of the keyboard
+Replay playback;
+
+// Her tuş olayı zaman damgası alır; uygulandığı adım ekrana basılınca gecikme ölçülür
+// Every key event is timestamped; latency is measured when the step that applied it is presented
+InputLatency inputLatency;
+
+// Kare temposu: --vsync on|off|adaptive, --fps N; F4 kipler arasında dolaşır
+// Frame pacing: --vsync on|off|adaptive, --fps N; F4 cycles through the modes
+FramePacer pacer;
+bool adaptiveVsyncSupported = false;
+
+// Aşama zamanlayıcıları; F3 grafiği açar, --trace çıkışta Chrome trace JSON yazar
+// Stage timers; F3 shows the graph, --trace writes Chrome trace JSON on exit
+Profiler profiler;
+bool showProfiler = false;
+std::string tracePath;
+std::vector<std::string> profilerLines;
+std::vector<float> profilerFrameMs;
+
+// Tüm çizim bu arka uçtan geçer: OpenGL 3.3 core, açılamazsa sabit işlevli yol (--renderer)
+// All drawing goes through this backend: OpenGL 3.3 core, or the fixed-function path if that fails (--renderer)
+GlCoreBackend coreBackend;
+GlImmediateBackend immediateBackend;
+RenderBackend* renderer = &immediateBackend;
+bool preferCoreProfile = true;
+
+// Metin etiketleri önbellekli vertex buffer'lardan tek çağrıyla çizilir
+// Text labels are drawn with one call each from cached vertex buffers
+TextRenderer textRenderer;
+// Başlık ve HUD yalnızca değişince güncellenir => // Title and HUD only update on change
+HudModel hud;
+
+// Tüm parçacıklar tek bir çizim çağrısıyla çizilir => // All particles are drawn with a single draw call
+ParticleRenderer particleRenderer;
+// Bloklar ve power-up'lar örneklemeli çizilir; desteklenmezse şekiller tek tek çizilir
+// Blocks and power-ups are drawn instanced; the shapes are drawn one by one if unsupported
+SpriteRenderer spriteRenderer;
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
+    glViewport(0, 0, width, height);
 }
 
-// updateParticles fonksiyonunu değiştirin:
-void updateParticles(float deltaTime) {
-    // Parçacık sayısı 0 ise erken çık
-    if (particles.empty()) {
-        return;
+// İleriye dönük bildirimler
+void drawText(const std::string& text, float x, float y, float size, float r, float g, float b);
+void renderText(const std::string& text, float x, float y, float scale, float r, float g, float b);
+
+// Seçili kipin takas aralığını uygula; bağlam bu iş parçacığında güncel olmalı
+// Apply the swap interval of the selected mode; the context must be current on this thread
+void applyPacing() {
+    if (pacer.getMode() == PacingMode::AdaptiveVsync && !adaptiveVsyncSupported) {
+        std::cerr << "Adaptive vsync is not supported by this driver, using vsync" << std::endl;
+        pacer.setMode(PacingMode::Vsync);
     }
-    
-    // Güvenlik kontrolü ve sayı sınırlaması
-    if (particles.size() > MAX_PARTICLES) {
-        particles.resize(MAX_PARTICLES);
+    glfwSwapInterval(pacer.swapInterval());
+    std::cout << "Frame pacing: " << pacingModeName(pacer.getMode());
+    if (pacer.getMode() == PacingMode::Limited) {
+        std::cout << " (" << pacer.getTargetFps() << " FPS)";
     }
-    
-    // Remove-erase idiom kullanarak ölü parçacıkları güvenle sil
-    particles.erase(
-        std::remove_if(
-            particles.begin(), 
-            particles.end(),
-            [&](Particle& p) {
-                // Lifetime güncellemesi
-                p.lifetime -= deltaTime;
-                
-                // Eğer yaşam süresi bittiyse, kaldır
-                if (p.lifetime <= 0.0f) {
-                    return true; // Sil
-                }
-                
-                // Pozisyon güncelleme
-                p.x += p.vx * deltaTime;
-                p.y += p.vy * deltaTime;
-                
-                // Rotasyon güncelleme
-                p.rotation += p.rotationSpeed * deltaTime;
-                
-                // Yerçekimi ve yavaşlama 
-                p.vy -= 0.002f;
-                p.vx *= 0.98f;
-                p.vy *= 0.98f;
-                
-                // Alpha güncelleme
-                p.a = std::min(1.0f, p.lifetime);
-                
-                // Ekran dışındaysa sil
-                if (p.x < -2.0f || p.x > 2.0f || p.y < -2.0f || p.y > 2.0f) {
-                    return true; // Sil
-                }
-                return false; // Sakla
-            }
-        ),
-        particles.end()
-    );
+    std::cout << std::endl;
 }
 
-// Farklı parçacık şekilleri çizmek için fonksiyon
-void drawParticle(const Particle& p) {
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    
-    glPushMatrix();
-    glTranslatef(p.x, p.y, 0.0f);
-    glRotatef(p.rotation, 0.0f, 0.0f, 1.0f);
-    
-    // Kare parçacık
-    glColor4f(p.r, p.g, p.b, p.a);
-    glBegin(GL_QUADS);
-        glVertex2f(-p.size/2, -p.size/2);
-        glVertex2f(p.size/2, -p.size/2);
-        glVertex2f(p.size/2, p.size/2);
-        glVertex2f(-p.size/2, p.size/2);
-    glEnd();
-    
-    glPopMatrix();
-    glDisable(GL_BLEND);
+// Kare aralığı istatistikleri; aralık takastan takasa ölçülür
+// Frame interval statistics; the interval is measured from swap to swap
+void printPacingStats(const char* prefix) {
+    FramePacingStats pacing = pacer.stats();
+    std::cout << prefix << "Pacing " << pacingModeName(pacer.getMode()) << ": " << pacing.fps() << " FPS, "
+              << pacing.meanMs << " ms mean, jitter " << pacing.jitterMs << " ms, p50 " << pacing.p50Ms
+              << " p99 " << pacing.p99Ms << " max " << pacing.maxMs << " ms";
 }
 
-// Parçacık çizim fonksiyonunu güvenceye al
-void drawParticles() {
-    int maxParticlesToDraw = 100; // Limiti azalt
-    int count = 0;
-    for (const auto& p : particles) {
-        if (count++ > maxParticlesToDraw) break; // Çizilecek parçacık sayısını sınırla
-        drawParticle(p);
+// Olayı zaman damgasıyla simülasyona gönder => // Send the event to the simulation with a timestamp
+void postInput(InputAction action) {
+    InputEvent event = inputLatency.stamp(action);
+    if (!simThread->postInput(event)) {
+        inputLatency.dropped(event);
     }
 }
 
-// Çarpışma animasyonu için fonksiyon
-void createBlockExplosion(float x, float y, float r, float g, float b) {
-    // Parçacık sayısı
-    const int numParticles = 20;
-    
-    // Parçacıkların yayılma aralığı
-    const float spread = 0.15f;
-    
-    for (int i = 0; i < numParticles; i++) {
-        // Rastgele hız vektörü oluştur
-        float angle = (rand() % 360) * 3.14159f / 180.0f;
-        float speed = 0.1f + (rand() % 100) / 500.0f;
-        float vx = cos(angle) * speed;
-        float vy = sin(angle) * speed;
-        
-        // Parçacık boyutu
-        float size = 0.01f + (rand() % 100) / 2000.0f;
-        
-        // Ömür
-        float lifetime = 0.5f + (rand() % 100) / 200.0f;
-        
-        // Renk varyasyonu ekle
-        float colorVar = 0.2f;
-        float rVal = r + ((rand() % 100) / 100.0f - 0.5f) * colorVar;
-        float gVal = g + ((rand() % 100) / 100.0f - 0.5f) * colorVar;
-        float bVal = b + ((rand() % 100) / 100.0f - 0.5f) * colorVar;
-        
-        // Değerleri sınırla
-        rVal = std::max(0.0f, std::min(1.0f, rVal));
-        gVal = std::max(0.0f, std::min(1.0f, gVal));
-        bVal = std::max(0.0f, std::min(1.0f, bVal));
-        
-        // Rastgele başlangıç pozisyonu (bloğun etrafında)
-        float startX = x + ((rand() % 100) / 100.0f - 0.5f) * 0.1f;
-        float startY = y + ((rand() % 100) / 100.0f - 0.5f) * 0.1f;
-        
-        // Parçacık oluştur
-        float rotation = rand() % 360;
-        float rotationSpeed = ((rand() % 200) - 100) * 2.0f; // -200 ile 200 derece/san arası
-        
-        createParticle(startX, startY, vx, vy, rVal, gVal, bVal, 1.0f, lifetime, size, rotation, rotationSpeed);
+// Tuşlar hemen uygulanmaz; simülasyon iş parçacığına bir sonraki adımın başı için gönderilir.
+// Yön tuşları basılı tutuldukça simülasyon her adım hareket ettirir; tekrar olayları yok sayılır.
+// Keys are not applied immediately; they are sent to the simulation thread for the start of the next step.
+// While a direction key is held the simulation moves every step; repeat events are ignored.
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    if (action == GLFW_RELEASE) {
+        switch (key) {
+            case GLFW_KEY_LEFT: postInput(InputAction::LeftUp); break;
+            case GLFW_KEY_RIGHT: postInput(InputAction::RightUp); break;
+            default: break;
+        }
+        return;
     }
-}
-
-// Level up efektini oluşturan fonksiyonu düzelt
-void createLevelUpEffect() {
-    // Taşmayı önlemek için mevcut parçacıkları temizle
-    particles.clear(); // Mevcut tüm parçacıkları temizle, kararlılık için
-    
-    // Parçacık sayısını sınırla
-    const int numRings = 2; // 3'ten 2'ye düşür
-    const int particlesPerRing = 20; // 30'dan 20'ye düşür
-    
-    for (int ring = 0; ring < numRings; ring++) {
-        float ringRadius = 0.2f + ring * 0.2f;
-        float ringLifetime = 1.0f - ring * 0.2f;
-        
-        for (int i = 0; i < particlesPerRing; i++) {
-            float angle = (i * 360.0f / particlesPerRing) * 3.14159f / 180.0f;
-            
-            // Parçacıklar dairesel harekette dışa doğru hareket eder
-            float vx = cos(angle) * 0.2f;
-            float vy = sin(angle) * 0.2f;
-            
-            // Halkadaki başlangıç pozisyonu
-            float x = cos(angle) * (0.05f + ring * 0.05f); // Merkeze yakın başla
-            float y = sin(angle) * (0.05f + ring * 0.05f);
-            
-            // Altın-sarı parçacıklar
-            float r = 1.0f;
-            float g = 0.9f - ring * 0.2f;
-            float b = 0.4f - ring * 0.1f;
-            
-            createParticle(x, y, vx, vy, r, g, b, 0.8f, ringLifetime, 0.03f, angle * 57.3f, 60.0f);
+    if (action != GLFW_PRESS) {
+        return;
+    }
+    // Profil grafiği yalnızca ön yüzü etkiler, kaydedilmez => // The profiler graph only affects the front end and is not recorded
+    if (key == GLFW_KEY_F3) {
+        showProfiler = !showProfiler;
+        return;
+    }
+    // Tempo da yalnızca ön yüzdür; oyun hızı değişmez => // Pacing is front end only too; game speed does not change
+    if (key == GLFW_KEY_F4) {
+        PacingMode next = (PacingMode)(((int)pacer.getMode() + 1) % (int)PacingMode::Count);
+        if (next == PacingMode::AdaptiveVsync && !adaptiveVsyncSupported) {
+            next = PacingMode::Limited;
         }
+        pacer.setMode(next);
+        applyPacing();
+        return;
     }
-    
-    // Beyaz parıltıları sınırla
-    const int maxSparkles = 20; // 50'den 20'ye düşür
-    for (int i = 0; i < maxSparkles; i++) {
-        float angle = (rand() % 360) * 3.14159f / 180.0f;
-        float dist = (rand() % 100) / 200.0f; // 0 ile 0.5 arası
-        
-        float x = cos(angle) * dist;
-        float y = sin(angle) * dist;
-        
-        // Merkezden dışa doğru hız vektörü
-        float speed = 0.05f + (rand() % 100) / 500.0f;
-        float vx = cos(angle) * speed;
-        float vy = sin(angle) * speed;
-        
-        float size = 0.01f + (rand() % 100) / 2000.0f;
-        float lifetime = 0.5f + (rand() % 100) / 200.0f;
-        
-        // Beyaz parıltı
-        float whiteness = 0.8f + (rand() % 20) / 100.0f; // 0.8 ile 1.0 arası
-        createParticle(x, y, vx, vy, whiteness, whiteness, whiteness, 0.9f, lifetime, size);
+    switch (key) {
+        case GLFW_KEY_ENTER: postInput(InputAction::Start); break;
+        case GLFW_KEY_P: postInput(InputAction::TogglePause); break;
+        case GLFW_KEY_M: postInput(InputAction::ToggleMute); break;
+        case GLFW_KEY_LEFT: postInput(InputAction::LeftDown); break;
+        case GLFW_KEY_RIGHT: postInput(InputAction::RightDown); break;
+        default: break;
     }
 }
 
-// Ekstra can toplama efekti
-void createHeartEffect(float x, float y) {
-    // Kalp şeklinde parçacıklar oluştur
-    for (int i = 0; i < 20; i++) {
-        float angle = (rand() % 360) * 3.14159f / 180.0f;
-        float speed = 0.05f + (rand() % 100) / 1000.0f;
-        float vx = cos(angle) * speed;
-        float vy = sin(angle) * speed + 0.01f; // Hafif yukarı yönelim
-        
-        float size = 0.01f + (rand() % 100) / 5000.0f;
-        float lifetime = 1.0f + (rand() % 100) / 200.0f;
-        
-        // Kalp şeklindeki parçacıklar kırmızı/pembe
-        createParticle(x, y, vx, vy, 1.0f, 0.2f + (rand() % 50) / 100.0f, 0.4f, 
-                      1.0f, lifetime, size, 0, (rand() % 200) - 100);
+// Odak kaybolunca bırakma olayları gelmez; basılı tuşları burada bırak
+// Release events are not delivered after focus is lost; release held keys here
+void window_focus_callback(GLFWwindow* window, int focused) {
+    if (!focused) {
+        postInput(InputAction::LeftUp);
+        postInput(InputAction::RightUp);
     }
 }
 
-// Kalkan kırılma efekti
-void createShieldBreakEffect(float x, float y) {
-    const int numParticles = 30;
-    const float radius = 0.15f;
-    
-    for (int i = 0; i < numParticles; i++) {
-        float angle = (i * 360.0f / numParticles) * 3.14159f / 180.0f;
-        
-        // Parçacıklar kalkan yarıçapında başlar
-        float startX = x + cos(angle) * radius;
-        float startY = y + sin(angle) * radius;
-        
-        // Dışa doğru hız
-        float speed = 0.1f + (rand() % 100) / 500.0f;
-        float vx = cos(angle) * speed;
-        float vy = sin(angle) * speed;
-        
-        // Kalkan parçacıkları mavi/camgöbeği
-        createParticle(startX, startY, vx, vy, 0.3f, 0.8f, 1.0f, 
-                      0.8f, 0.5f, 0.02f, rand() % 360, (rand() % 400) - 200);
+void toggleMute() {
+    isMuted = !isMuted;
+    if (isMuted) {
+        previousVolume = sigma.getVolume();
+        sigma.setVolume(0.0f);
+        voicePool.setVolume(0.0f);
+        std::cout << "Ses kapatıldı" << std::endl;
+    } else {
+        sigma.setVolume(previousVolume);
+        voicePool.setVolume(100.0f);
+        std::cout << "Ses açıldı" << std::endl;
     }
 }
 
-// Büyük patlama efekti
-void createMassiveExplosion(float x, float y, float radius) {
-    // Önce parlak bir flaş oluştur
-    for (int i = 0; i < 50; i++) {
-        float angle = (rand() % 360) * 3.14159f / 180.0f;
-        float distance = (rand() % 100) / 100.0f * radius;
-        float startX = x + cos(angle) * distance;
-        float startY = y + sin(angle) * distance;
-        
-        // Flaş parçacıkları - parlak beyaz/sarı ve kısa ömürlü
-        createParticle(startX, startY, 0, 0, 1.0f, 1.0f, 0.8f, 
-                      0.9f, 0.2f, 0.05f + (rand() % 100) / 1000.0f);
+// Ön yüz tarafını (müzik, ses) görüntüdeki durum geçişlerine göre güncelle
+// Update the front-end side (music, volume) from state transitions between snapshots
+void syncAudio(const RenderSnapshot& view) {
+    static bool wasRunning = false;
+    static bool wasGameOver = false;
+    static bool wasPaused = false;
+    static uint32_t handledMuteToggles = 0;
+
+    while (handledMuteToggles != view.muteToggles) {
+        toggleMute();
+        handledMuteToggles++;
     }
-    
-    // Sonra patlama molozları oluştur
-    for (int i = 0; i < 100; i++) {
-        float angle = (rand() % 360) * 3.14159f / 180.0f;
-        float speed = 0.1f + (rand() % 200) / 500.0f;
-        float vx = cos(angle) * speed;
-        float vy = sin(angle) * speed;
-        
-        // Patlama parçacıkları - kırmızı/turuncu ve daha uzun ömürlü
-        float r = 0.8f + (rand() % 20) / 100.0f;
-        float g = 0.3f + (rand() % 40) / 100.0f;
-        float b = 0.0f;
-        
-        createParticle(x, y, vx, vy, r, g, b, 
-                      1.0f, 1.0f, 0.02f + (rand() % 100) / 2000.0f, 
-                      rand() % 360, (rand() % 400) - 200);
-    }
-    
-    // Kalıcı duman parçacıkları ekle
-    for (int i = 0; i < 40; i++) {
-        float angle = (rand() % 360) * 3.14159f / 180.0f;
-        float speed = 0.03f + (rand() % 100) / 2000.0f;
-        float vx = cos(angle) * speed;
-        float vy = sin(angle) * speed + 0.01f; // Hafif yukarı yönelim
-        
-        float gray = 0.2f + (rand() % 60) / 100.0f;
-        
-        // Daha büyük, daha yavaş duman parçacıkları oluştur
-        createParticle(x, y, vx, vy, gray, gray, gray, 
-                      0.7f, 2.0f + (rand() % 100) / 100.0f, 
-                      0.04f + (rand() % 100) / 1000.0f, 
-                      rand() % 360, (rand() % 100) - 50);
-    }
-}
 
-// resetGame() fonksiyonunda seviyeye dayalı blok hareket desenleri ayarla
-void resetGame() {
-    playerX = 0.0f;
-    score = 0;
-    health = 3;
-    level = 1;
-    blockSpeed = 0.01f;
-    gameOver = false;
-    blocks.clear();
-    powerUps.clear();  
-    isInvisible = false;
-    invisibilityTimer = 0.0f;
-    playerSpeed = originalPlayerSpeed;
-    backgroundColor = 0.0f;
-    colorIncreasing = true;
-    hasSpeedBoost = false;
-    speedBoostTimer = 0.0f;
-    hasBlockReset = false;
-    blockResetTimer = 0.0f;
-    hasTimeSlow = false;
-    timeSlowTimer = 0.0f;
-    timeSlowFactor = 1.0f;
-    hasShield = false;
-    shieldTimer = 0.0f;
-    
-    // Parçacıkları temizle
-    particles.clear();
-
-    // resetGame() içinde seviye tabanlı hareket deseni atamasıyla bloklar oluştur
-    for (int i = 0; i < 3; i++) {
-        float r = 0.7f + ((float)rand() / RAND_MAX) * 0.3f; // Ağırlıklı kırmızı renk
-        float g = 0.0f + ((float)rand() / RAND_MAX) * 0.3f; 
-        float b = 0.0f + ((float)rand() / RAND_MAX) * 0.3f;
-        
-        float xPos = (rand() % 200 - 100) / 100.0f;
-        
-        // Seviye 3'ten önce sadece doğrusal hareket (0)
-        int movementPattern = 0; // Başlangıçta her zaman doğrusal
-        
-        blocks.push_back({
-            xPos,                      // x
-            1.0f,                      // y
-            rand() % 3,                // şekil (0, 1 veya 2)
-            r, g, b,                   // renk
-            movementPattern,           // hareket deseni (başlangıçta her zaman 0)
-            0.0f,                      // hareket sayacı
-            xPos                       // başlangıç X pozisyonu
-        });
+    bool running = view.gameStarted && !view.gameOver;
+    if (running && !wasRunning) {
+        sigma.play();
     }
-
-    std::cout << "Oyun Sıfırlandı! Yeni oyun başladı!" << std::endl;
-}
-
-void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
-    glViewport(0, 0, width, height);
-}
-
-// İleriye dönük bildirimler
-void drawText(const std::string& text, float x, float y, float size, float r, float g, float b);
-bool loadFont();
-void renderText(const std::string& text, float x, float y, float scale, float r, float g, float b);
-
-void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
-    if (action == GLFW_PRESS) {
-        if (!gameStarted && key == GLFW_KEY_ENTER) {
-            gameStarted = true;
-            resetGame(); // Bu fonksiyonu çağırıyoruz
-            powerUps.clear();  // Tüm güç artırımlarını temizle
-            fadeInEffect = true;
-            fadeAlpha = 1.0f;
-            sigma.play();
-        } 
-        else if (gameOver && key == GLFW_KEY_ENTER) {
-            resetGame();
-            powerUps.clear(); 
-            fadeInEffect = true;
-            fadeAlpha = 1.0f;
+    // Oyun sonu sesiyle aynı adımda; görüntüye bağlı ki müzik kontrolüyle yarışmasın
+    // Same step as the game-over sound; tied to the snapshot so it cannot race the music control
+    if (view.gameOver && !wasGameOver) {
+        sigma.stop();
+    }
+    if (view.isPaused != wasPaused) {
+        if (view.isPaused) {
+            sigma.pause();
+            std::cout << "Oyun Duraklatıldı" << std::endl;
+        } else {
             sigma.play();
-        }
-        else if (gameStarted && !gameOver) {
-            if (key == GLFW_KEY_P) {
-                isPaused = !isPaused;
-                if (isPaused) {
-                    sigma.pause();
-                    std::cout << "Oyun Duraklatıldı" << std::endl;
-                } else {
-                    sigma.play();
-                    std::cout << "Oyun Devam Ediyor" << std::endl;
-                }
-            }
-            else if (key == GLFW_KEY_M) {
-                isMuted = !isMuted;
-                if (isMuted) {
-                    previousVolume = sigma.getVolume();
-                    sigma.setVolume(0.0f);
-                    collisionSound.setVolume(0.0f);
-                    powerUpSound.setVolume(0.0f);
-                    levelUpSound.setVolume(0.0f);
-                    gameOverSound.setVolume(0.0f);
-                    std::cout << "Ses kapatıldı" << std::endl;
-                } else {
-                    sigma.setVolume(previousVolume);
-                    collisionSound.setVolume(100.0f);
-                    powerUpSound.setVolume(100.0f);
-                    levelUpSound.setVolume(100.0f);
-                    gameOverSound.setVolume(100.0f);
-                    std::cout << "Ses açıldı" << std::endl;
-                }
-            }
-            
-            // Aktif oyunda oyuncu hareketi
-            if (!isPaused) {
-                if (key == GLFW_KEY_LEFT && playerX > -0.9f) playerX -= playerSpeed;
-                if (key == GLFW_KEY_RIGHT && playerX < 0.9f) playerX += playerSpeed;
-            }
+            std::cout << "Oyun Devam Ediyor" << std::endl;
         }
     }
+    wasRunning = running;
+    wasGameOver = view.gameOver;
+    wasPaused = view.isPaused;
+
+    // Music control
+    if (running && !view.isPaused && sigma.getStatus() != sf::Music::Status::Playing) {
+        sigma.play();
+    }
 }
 
 void drawRectangle(float x, float y, float width, float height, float r, float g, float b) {
-    glColor3f(r, g, b);
-    glBegin(GL_QUADS);
-        glVertex2f(x, y);
-        glVertex2f(x + width, y);
-        glVertex2f(x + width, y - height);
-        glVertex2f(x, y - height);
-    glEnd();
+    renderer->rect(x, y, width, height, r, g, b);
 }
 
-bool loadFont() {
-    // Basit tek genişlikli font için piksel dizisi oluştur
-    unsigned char* fontData = new unsigned char[FONT_TEXTURE_WIDTH * FONT_TEXTURE_HEIGHT * 4];
-    
-    // Font dokusunu şeffaf siyaha temizle
-    for (int i = 0; i < FONT_TEXTURE_WIDTH * FONT_TEXTURE_HEIGHT * 4; i += 4) {
-        fontData[i] = 255;     // K
-        fontData[i+1] = 255;   // Y
-        fontData[i+2] = 255;   // M
-        fontData[i+3] = 0;     // A (şeffaf)
+// Merkezden yelpaze: yay tablosunun noktalarıyla daire ya da yarım daire
+// A fan from the centre: a circle or half circle through the points of an arc table
+template <size_t N>
+void drawFan(float centerX, float centerY, float radius, const std::array<SinCos, N>& arc,
+             float r, float g, float b, float a = 1.0f) {
+    float points[(N + 1) * 2];
+    points[0] = centerX;
+    points[1] = centerY;
+    for (size_t i = 0; i < N; i++) {
+        points[2 + i * 2] = centerX + arc[i].c * radius;
+        points[3 + i * 2] = centerY + arc[i].s * radius;
     }
-    
-    // Basit bitmap font
-    const int charWidth = 16;
-    const int charHeight = 24;
-    const int charsPerRow = FONT_TEXTURE_WIDTH / charWidth;
-    
-    // Temel karakterleri çiz
-    for (int c = 32; c < 128; c++) {
-        int row = (c - 32) / charsPerRow;
-        int col = (c - 32) % charsPerRow;
-        
-        int startX = col * charWidth;
-        int startY = row * charHeight;
-        
-        // Karakter çiz
-        for (int y = 0; y < charHeight; y++) {
-            for (int x = 0; x < charWidth; x++) {
-                int pixelPos = ((startY + y) * FONT_TEXTURE_WIDTH + (startX + x)) * 4;
-                
-                // Harf şekilleri çizmek için basit algoritma
-                bool isPixelSet = false;
-                
-                switch (c) {
-                    case 'A':
-                    case 'a':
-                        isPixelSet = (x == 0 || x == charWidth-1 || y == 0 || y == charHeight/2);
-                        break;
-                    case 'B':
-                    case 'b':
-                        isPixelSet = (x == 0 || 
-                                    (y == 0 && x < charWidth-2) || 
-                                    (y == charHeight-1 && x < charWidth-2) ||
-                                    (y == charHeight/2 && x < charWidth-2) || 
-                                    (x == charWidth-2 && (y > 0 && y < charHeight/2-1)) ||
-                                    (x == charWidth-2 && y > charHeight/2+1 && y < charHeight-1));
-                        break;
-                    case 'C':
-                    case 'c':
-                        isPixelSet = ((x == 0 && y > 0 && y < charHeight-1) || 
-                                    (y == 0 && x > 0) || 
-                                    (y == charHeight-1 && x > 0));
-                        break;
-                    default:
-                        // Diğer karakterler için basit bir yer tutucu oluştur
-                        isPixelSet = (x == 0 || y == 0 || x == charWidth-1 || y == charHeight-1 || 
-                                     x == y || x == charWidth-y);
-                }
-                
-                if (isPixelSet) {
-                    fontData[pixelPos] = 255;     // K
-                    fontData[pixelPos+1] = 255;   // Y
-                    fontData[pixelPos+2] = 255;   // M
-                    fontData[pixelPos+3] = 255;   // A (opak)
-                }
-            }
-        }
-        
-        // Karakteri eşlemeye ekle
-        Character ch;
-        ch.advanceX = charWidth;
-        ch.advanceY = 0;
-        ch.width = charWidth;
-        ch.height = charHeight;
-        ch.texX = (float)startX / FONT_TEXTURE_WIDTH;
-        ch.texY = (float)startY / FONT_TEXTURE_HEIGHT;
-        ch.texWidth = (float)charWidth / FONT_TEXTURE_WIDTH;
-        ch.texHeight = (float)charHeight / FONT_TEXTURE_HEIGHT;
-        
-        characters[c] = ch;
-    }
-    
-    // Dokuyu oluştur
-    glGenTextures(1, &fontTextureID);
-    glBindTexture(GL_TEXTURE_2D, fontTextureID);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, FONT_TEXTURE_WIDTH, FONT_TEXTURE_HEIGHT, 0, 
-                GL_RGBA, GL_UNSIGNED_BYTE, fontData);
-    
-    // Doku parametrelerini ayarla
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    
-    // Temizleme
-    delete[] fontData;
-    
-    fontLoaded = true;
-    return true;
+    renderer->polygon(points, N + 1, r, g, b, a);
 }
 
 void renderText(const std::string& text, float x, float y, float scale, float r, float g, float b) {
-    if (!fontLoaded) {
-        if (!loadFont()) {
-            // Font yükleme başarısız olursa, dikdörtgen tabanlı metne geri dön
-            drawText(text, x, y, scale, r, g, b);
-            return;
-        }
-    }
-    
-    // Enable texturing and blending
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, fontTextureID);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    
-    // Set text color
-    glColor3f(r, g, b);
-    
-    float currentX = x;
-    float currentY = y;
-    
-    // Render each character
-    for (char c : text) {
-        // Newline handling
-        if (c == '\n') {
-            currentY -= 30.0f * scale;
-            currentX = x;
-            continue;
-        }
-        
-        // Space handling
-        if (c == ' ') {
-            currentX += 16.0f * scale;
-            continue;
-        }
-        
-        // Skip characters not in our font
-        if (characters.find(c) == characters.end()) {
-            currentX += 16.0f * scale;
-            continue;
-        }
-        
-        Character ch = characters[c];
-        
-        float xpos = currentX;
-        float ypos = currentY - ch.height * scale;
-        
-        // Render the character quad
-        glBegin(GL_QUADS);
-            glTexCoord2f(ch.texX, ch.texY + ch.texHeight);
-            glVertex2f(xpos, ypos);
-            
-            glTexCoord2f(ch.texX + ch.texWidth, ch.texY + ch.texHeight);
-            glVertex2f(xpos + ch.width * scale, ypos);
-            
-            glTexCoord2f(ch.texX + ch.texWidth, ch.texY);
-            glVertex2f(xpos + ch.width * scale, ypos + ch.height * scale);
-            
-            glTexCoord2f(ch.texX, ch.texY);
-            glVertex2f(xpos, ypos + ch.height * scale);
-        glEnd();
-        
-        // Advance cursor
-        currentX += ch.advanceX * scale;
-        currentY += ch.advanceY * scale;
+    if (!textRenderer.isAvailable()) {
+        // Font yüklenemediyse, dikdörtgen tabanlı metne geri dön
+        drawText(text, x, y, scale, r, g, b);
+        return;
     }
-    
-    // Disable texture and blending when done
-    glDisable(GL_BLEND);
-    glDisable(GL_TEXTURE_2D);
+    textRenderer.draw(text, x, y, scale, r, g, b);
 }
 
-void drawPowerUp(const PowerUp& powerUp) {
+void drawPowerUp(const Position& powerUp, int type) {
     float r = 0.0f, g = 0.0f, b = 0.0f;
-    switch (powerUp.type) {
+    switch (type) {
         case 1: // Speed - Green
             g = 1.0f;
             break;
@@ -741,79 +307,49 @@ void drawPowerUp(const PowerUp& powerUp) {
     }
     
     // Extra life için özel parıltı efekti => // Special glow effect for Extra Life
-    if (powerUp.type == 6) {
-        // Parlak bir arka plan çizimi => // Draw a bright background
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-        glColor4f(r, g, b, 0.3f);
-        
-        // Extra Life için daha büyük bir arka plan hale => // Larger background halo for Extra Life
+    if (type == 6) {
+        // Extra Life için daha büyük, yarı saydam bir arka plan hale => // Larger, translucent background halo for Extra Life
         float size = 0.12f;
-        glBegin(GL_QUADS);
-            glVertex2f(powerUp.x - (size-0.08f)/2, powerUp.y + (size-0.08f)/2);
-            glVertex2f(powerUp.x + 0.08f + (size-0.08f)/2, powerUp.y + (size-0.08f)/2);
-            glVertex2f(powerUp.x + 0.08f + (size-0.08f)/2, powerUp.y - 0.08f - (size-0.08f)/2);
-            glVertex2f(powerUp.x - (size-0.08f)/2, powerUp.y - 0.08f - (size-0.08f)/2);
-        glEnd();
-        
-        glDisable(GL_BLEND);
+        renderer->rect(powerUp.x - (size-0.08f)/2, powerUp.y + (size-0.08f)/2, size, size, r, g, b, 0.3f);
     }
     
     // Normal power-up çizimi => // Normal power-up drawing
     drawRectangle(powerUp.x, powerUp.y, 0.08f, 0.08f, r, g, b);
     
     // Extra life için kalp sembolü ekle => // Add heart symbol for Extra Life
-    if (powerUp.type == 6) {
-        // Kalp şekli için kırmızı renk => // Red color for heart shape
-        glColor3f(1.0f, 0.0f, 0.0f);
-        
+    if (type == 6) {
         // Basit bir kalp şekli (üstte iki yarım daire, altta üçgen) => // Simple heart shape (two half circles on top, triangle at bottom)
         float centerX = powerUp.x + 0.04f;
         float centerY = powerUp.y - 0.04f;
         float size = 0.03f;
         
-        // Sol yarım daire => // Left half circle
+        // Sol ve sağ yarım daireler, kırmızı => // Left and right half circles, red
         const int segments = 10;
-        glBegin(GL_POLYGON);
-            for (int i = 0; i <= segments; i++) {
-                float angle = i * 3.14159f / segments;
-                float x = centerX - size/2 + cos(angle) * size/2;
-                float y = centerY + sin(angle) * size/2;
-                glVertex2f(x, y);
-            }
-        glEnd();
-        
-        // Sağ yarım daire => // Right half circle 
-        glBegin(GL_POLYGON);
-            for (int i = 0; i <= segments; i++) {
-                float angle = i * 3.14159f / segments;
-                float x = centerX + size/2 + cos(angle) * size/2;
-                float y = centerY + sin(angle) * size/2;
-                glVertex2f(x, y);
-            }
-        glEnd();
+        drawFan(centerX - size/2, centerY, size/2, HALF_CIRCLE<segments>, 1.0f, 0.0f, 0.0f);
+        drawFan(centerX + size/2, centerY, size/2, HALF_CIRCLE<segments>, 1.0f, 0.0f, 0.0f);
         
         // Alt üçgen => // Bottom triangle
-        glBegin(GL_TRIANGLES);
-            glVertex2f(centerX - size, centerY);
-            glVertex2f(centerX + size, centerY);
-            glVertex2f(centerX, centerY - size*1.5f);
-        glEnd();
+        renderer->triangle(centerX - size, centerY, centerX + size, centerY, centerX, centerY - size*1.5f,
+                           1.0f, 0.0f, 0.0f);
     }
 }
 
-void updateWindowTitle(GLFWwindow* window) {
-    std::ostringstream title;
-    if (!gameStarted) {
-        title << "Welcome to the Game! Press ENTER.";
-    } else if (gameOver) {
-        title << "Game Over! Score: " << score << " | Press ENTER to Restart";
-    } else if (isPaused) {
-        title << "PAUSED | Press P to Resume";
-    } else {
-        title << "Avoidance Game | Level: " << level << " | Score: " << score << " | Health: " << health;
+// Pencere başlığını yalnızca metni değiştiğinde güncelle (pencere sistemine gidiş-dönüş)
+// Only update the window title when its text changed (a window-system round trip)
+void updateWindowTitle(GLFWwindow* window, const RenderSnapshot& view) {
+    unsigned changed = hud.update(view);
+    if (changed & HUD_TITLE) {
+        glfwSetWindowTitle(window, hud.title().c_str());
     }
-    glfwSetWindowTitle(window, title.str().c_str());
+}
+
+// Skor, seviye ve can etiketleri; her biri önbellekten tek çizim çağrısı
+// Score, level and health labels; one cached draw call each
+void drawHud() {
+    const float scale = 0.05f;
+    renderText(hud.scoreLabel(), -0.95f, 0.95f, scale, 1.0f, 1.0f, 1.0f);
+    renderText(hud.levelLabel(), -0.95f, 0.87f, scale, 1.0f, 0.9f, 0.4f);
+    renderText(hud.healthLabel(), -0.95f, 0.79f, scale, 1.0f, 0.4f, 0.4f);
 }
 
 // Create a function to draw text (basic approach with rectangles)
@@ -842,53 +378,36 @@ void drawText(const std::string& text, float x, float y, float size, float r, fl
 }
 
 void drawTriangle(float x, float y, float size, float r, float g, float b) {
-    glColor3f(r, g, b);
-    glBegin(GL_TRIANGLES);
-        glVertex2f(x, y);
-        glVertex2f(x + size, y);
-        glVertex2f(x + size/2, y - size);
-    glEnd();
+    renderer->triangle(x, y, x + size, y, x + size/2, y - size, r, g, b);
 }
 
 // Fix circle drawing function
 void drawCircle(float x, float y, float radius, float r, float g, float b) {
     const int segments = 20;
-    const float fullCircle = 2.0f * 3.14159f;
     
-    glColor3f(r, g, b);
-    glBegin(GL_TRIANGLE_FAN);
-        // Center point - make sure this is within bounds
-        float centerX = x + radius/2;
-        float centerY = y - radius/2;
-        glVertex2f(centerX, centerY);
-        
-        // Circle outline points
-        for (int i = 0; i <= segments; i++) {
-            float angle = i * fullCircle / segments;
-            float px = centerX + cos(angle) * radius/2;
-            float py = centerY + sin(angle) * radius/2;
-            glVertex2f(px, py);
-        }
-    glEnd();
+    // Center point - make sure this is within bounds
+    float centerX = x + radius/2;
+    float centerY = y - radius/2;
+    drawFan(centerX, centerY, radius/2, UNIT_CIRCLE<segments>, r, g, b);
 }
 
 // Change block color to visually indicate difficulty
-void drawBlock(const Block& block) {
+void drawBlock(const Position& block, int shape, int movementPattern, const Color& color) {
     // Color modification based on movement pattern
-    float r = block.r;
-    float g = block.g;
-    float b = block.b;
+    float r = color.r;
+    float g = color.g;
+    float b = color.b;
     
     // Increase brightness for more difficult movement patterns
-    if (block.movementPattern > 0) {
+    if (movementPattern > 0) {
         // Slightly brighten color for zigzag and circular movements
-        float brightnessFactor = 1.0f + (block.movementPattern * 0.2f);
+        float brightnessFactor = 1.0f + (movementPattern * 0.2f);
         r = std::min(1.0f, r * brightnessFactor);
         g = std::min(1.0f, g * brightnessFactor);
         b = std::min(1.0f, b * brightnessFactor);
     }
     
-    switch (block.shape) {
+    switch (shape) {
         case 0: // Square
             drawRectangle(block.x, block.y, 0.1f, 0.1f, r, g, b);
             break;
@@ -901,50 +420,7 @@ void drawBlock(const Block& block) {
     }
 }
 
-// Fix the block movement function to prevent potential out-of-bounds issues
-void updateBlockMovement(Block& block) {
-    // Level 3'e özel güvenlik kontrolü => // Special security check for Level 3
-    if (level == 3 && block.movementPattern != 0) {
-        // Level 3'te tüm blokları doğrusal hareket ettir => // Make all blocks move linearly in Level 3
-        block.movementPattern = 0;
-    }
-
-    try {
-        // Update position based on movement pattern
-        switch (block.movementPattern) {
-            case 0: // Linear - just move down
-                // y position is updated in the main loop
-                break;
-                
-            case 1: // Zigzag - horizontal sine wave (daha az agresif) => // Zigzag - horizontal sine wave (less aggressive) 
-                // Make sure the block doesn't go off screen
-                block.x = block.originX + sin(block.movementTimer * 2.0f) * 0.2f; // Daha az genlik => // Less amplitude
-                // Clamp to screen boundaries
-                if (block.x < -0.95f) block.x = -0.95f;
-                if (block.x > 0.95f) block.x = 0.95f;
-                block.movementTimer += 0.01f; // Daha yavaş => // Slower
-                break;
-                
-            case 2: // Circular - orbit around a center point
-                // Circular hareketi devre dışı bırak - hata kaynağı olabilir => // Disable circular movement - could be source of errors
-                block.movementPattern = 1;
-                block.x = block.originX + sin(block.movementTimer * 2.0f) * 0.15f;
-                block.movementTimer += 0.01f;
-                break;
-                
-            default:
-                // Geçersiz bir hareket paterni için güvenli davranış => // Safe behavior for invalid movement pattern
-                block.movementPattern = 0;
-                break;
-        }
-    }
-    catch (...) {
-        // Herhangi bir hata durumunda güvenli değerler ayarla => // Set safe values in case of any error
-        block.movementPattern = 0; // Doğrusal harekete zorla => // Force linear movement
-    }
-}
-
-void drawBackgroundEffects() {
+void drawBackgroundEffects(const RenderSnapshot& view) {
     // Stars in the background - statik değişkeni yerel değişkenle değiştir
     static std::vector<std::tuple<float, float, float>> stars;
     
@@ -953,7 +429,7 @@ void drawBackgroundEffects() {
     // Especially in the background lines section
     
     // Level-based background effects için daha güvenli kod
-    if (level >= 5) {
+    if (view.level >= 5) {
         static float lineTime = 0.0f; // Bu tek değişken olsun
         lineTime += 0.0005f;
         
@@ -966,16 +442,7 @@ void drawBackgroundEffects() {
             float g = 0.2f + cos(lineTime * 1.7f + i) * 0.1f;
             float b = 0.5f + sin(lineTime * 3.1f + i) * 0.2f;
             
-            glEnable(GL_BLEND);
-            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-            glColor4f(r, g, b, 0.2f);
-            
-            glBegin(GL_LINES);
-                glVertex2f(-1.0f, y1);
-                glVertex2f(1.0f, y2);
-            glEnd();
-            
-            glDisable(GL_BLEND);
+            renderer->line(-1.0f, y1, 1.0f, y2, r, g, b, 0.2f);
         }
     }
 }
@@ -983,716 +450,626 @@ void drawBackgroundEffects() {
 // cleanup fonksiyonunu değiştirin:
 void cleanup() {
     // Vektörleri temizle => // Clear vectors
-    blocks.clear();
-    powerUps.clear();
-    particles.clear();
+    game->blocks.clear();
+    game->powerUps.clear();
+    game->particles.clear();
     
     // SFML seslerini temizle => // Clear SFML sounds
-    collisionSound.stop();
-    powerUpSound.stop();
-    levelUpSound.stop();
-    gameOverSound.stop();
+    voicePool.stopAll();
     sigma.stop();
     
     // OpenGL kaynaklarını temizle => // Clear OpenGL resources
-    if (fontTextureID != 0) {
-        glDeleteTextures(1, &fontTextureID);
-        fontTextureID = 0;
-    }
+    textRenderer.release();
+    renderer->release();
     
-    // Zamanlanmış değişkenleri sıfırla => // Reset timed variables
-    timeSlowTimer = 0.0f;
-    speedBoostTimer = 0.0f;
-    invisibilityTimer = 0.0f;
-    blockResetTimer = 0.0f;
-    shieldTimer = 0.0f;
+    // Zamanlanmış etkileri sıfırla => // Reset timed effects
+    game->effects.clear();
 }
 
-int main() {
-    srand(time(0));
-    
-    // Define sound directory path
-    std::filesystem::path soundPath;
-    
-    // Check common locations for sound files
-    if (std::filesystem::exists("sounds")) {
-        soundPath = "sounds";
-    } else if (std::filesystem::exists("../sounds")) {
-        soundPath = "../sounds";
-    } else if (std::filesystem::exists("../../sounds")) {
-        soundPath = "../../sounds";
-    } else {
-        // Try to create sounds directory
-        try {
-            std::filesystem::create_directory("sounds");
-            soundPath = "sounds";
-            std::cout << "Created sounds directory at: " << std::filesystem::absolute(soundPath).string() << std::endl;
-        } catch(const std::exception& e) {
-            std::cerr << "Error creating sounds directory: " << e.what() << std::endl;
-            std::cerr << "Please create a 'sounds' folder in the executable directory." << std::endl;
-            return -1;
+// Simülasyonun ürettiği ses olaylarını ses havuzuna ilet => // Forward the simulation's sound events to the voice pool
+void playSoundEvents() {
+    SoundEvent event;
+    while (simThread->popSoundEvent(event)) {
+        switch (event) {
+            case SoundEvent::Collision:
+                voicePool.post(collisionClip);
+                break;
+            case SoundEvent::PowerUp:
+                voicePool.post(powerUpClip);
+                break;
+            case SoundEvent::LevelUp:
+                voicePool.post(levelUpClip);
+                break;
+            case SoundEvent::GameOver:
+                voicePool.post(gameOverClip);
+                break;
         }
     }
-    
-    std::cout << "Using sound directory: " << std::filesystem::absolute(soundPath).string() << std::endl;
-    
-    // Check if sound directory exists and contains required files
-    if (!std::filesystem::exists(soundPath) || 
-        !std::filesystem::exists(soundPath / "collision.wav") ||
-        !std::filesystem::exists(soundPath / "pickup.wav") ||
-        !std::filesystem::exists(soundPath / "levelup.wav") ||
-        !std::filesystem::exists(soundPath / "gameover.wav") ||
-        !std::filesystem::exists(soundPath / "sigma.wav")) {
-        
-        std::cerr << "Sound directory missing required files!" << std::endl;
-        // Enable SFML error messages
-        std::cerr << "Please place the following WAV files in " << soundPath.string() << ":" << std::endl;
-        std::cerr << "- collision.wav\n- pickup.wav\n- levelup.wav\n- gameover.wav\n- background.wav\n- sigma.wav" << std::endl;
-        return -1;
+    voicePool.update();
+}
+
+// Yarı saydam tam ekran katman çiz => // Draw a translucent full-screen overlay
+void drawOverlay(float r, float g, float b, float a) {
+    renderer->rect(-1.0f, 1.0f, 2.0f, 2.0f, r, g, b, a);
+}
+
+// Sağ üstte kare süresi grafiği ve aşama başına p50/p99 (F3 ile aç/kapa)
+// Frame-time graph and per-stage p50/p99 in the top right (toggled with F3)
+void drawProfilerOverlay() {
+    const float left = 0.3f, right = 0.98f, top = 0.98f, bottom = 0.3f;
+    const float graphTop = 0.62f;
+    const float graphMaxMs = 33.3f;
+
+    // Metinleri saniyede birkaç kez yenile ki metin önbelleği dönmesin
+    // Refresh the text a few times a second so the text cache does not churn
+    static int refreshCountdown = 0;
+    if (--refreshCountdown <= 0) {
+        refreshCountdown = 15;
+        const ProfileStage shown[] = {
+            ProfileStage::Frame, ProfileStage::Simulation, ProfileStage::Particles, ProfileStage::Render, ProfileStage::DrawBlocks,
+            ProfileStage::DrawParticles, ProfileStage::DrawHud, ProfileStage::Swap
+        };
+        const size_t stageCount = sizeof(shown) / sizeof(shown[0]);
+        profilerLines.resize(stageCount + 2);
+        for (size_t i = 0; i < stageCount; i++) {
+            char line[64];
+            std::snprintf(line, sizeof(line), "%-14s p50 %6.2f  p99 %6.2f ms", profileStageName(shown[i]),
+                          profiler.percentileMs(shown[i], 0.5f), profiler.percentileMs(shown[i], 0.99f));
+            profilerLines[i] = line;
+        }
+        // Kare toplamı değil olay başına gecikme => // Per-event latency, not a frame total
+        char line[64];
+        std::snprintf(line, sizeof(line), "%-14s p50 %6.2f  p99 %6.2f ms", "input->photon",
+                      inputLatency.percentileMs(0.5f), inputLatency.percentileMs(0.99f));
+        profilerLines[stageCount] = line;
+        FramePacingStats pacing = pacer.stats();
+        std::snprintf(line, sizeof(line), "%-14s mean %6.2f  jit %6.2f ms", pacingModeName(pacer.getMode()),
+                      pacing.meanMs, pacing.jitterMs);
+        profilerLines[stageCount + 1] = line;
     }
 
-    // Load sound files
-    if (!collisionBuffer.loadFromFile((soundPath / "collision.wav").string())) {
-        std::cerr << "Collision sound failed to load: " << (soundPath / "collision.wav").string() << std::endl;
-        std::cerr << "File size: " << std::filesystem::file_size(soundPath / "collision.wav") << " bytes" << std::endl;
-    } else {
-        std::cout << "Collision sound loaded successfully!" << std::endl;
-        std::cout << "Sample rate: " << collisionBuffer.getSampleRate() << std::endl;
-        std::cout << "Channel count: " << collisionBuffer.getChannelCount() << std::endl;
-        std::cout << "Duration: " << collisionBuffer.getDuration().asSeconds() << " seconds" << std::endl;
-        collisionSound.setBuffer(collisionBuffer);
+    renderer->rect(left, top, right - left, top - bottom, 0.0f, 0.0f, 0.0f, 0.6f);
+
+    // Kare süresi çubukları; core arka uçta tek çizim çağrısında toplanır
+    // Frame-time bars; the core backend gathers them into a single draw call
+    profiler.frameHistoryMs(profilerFrameMs);
+    float barWidth = (right - left) / Profiler::FRAME_HISTORY;
+    for (size_t i = 0; i < profilerFrameMs.size(); i++) {
+        float ms = profilerFrameMs[i];
+        float height = std::min(ms / graphMaxMs, 1.0f) * (graphTop - bottom);
+        float x = left + i * barWidth;
+        if (ms > 16.7f) {
+            renderer->rect(x, bottom + height, barWidth, height, 1.0f, 0.3f, 0.2f, 0.9f);
+        } else {
+            renderer->rect(x, bottom + height, barWidth, height, 0.3f, 1.0f, 0.4f, 0.9f);
+        }
     }
 
-    if (!powerUpBuffer.loadFromFile((soundPath / "pickup.wav").string())) {
-        std::cerr << "Power-up sound failed to load: " << (soundPath / "pickup.wav").string() << std::endl;
-        return -1;
-    } else {
-        powerUpSound.setBuffer(powerUpBuffer);
+    // 60 FPS çizgisi => // 60 FPS line
+    float targetY = bottom + (16.7f / graphMaxMs) * (graphTop - bottom);
+    renderer->line(left, targetY, right, targetY, 1.0f, 1.0f, 1.0f, 0.5f);
+
+    for (size_t i = 0; i < profilerLines.size(); i++) {
+        renderText(profilerLines[i], left + 0.01f, top - 0.01f - i * 0.045f, 0.024f, 0.9f, 0.9f, 0.9f);
     }
+}
 
-    if (!levelUpBuffer.loadFromFile((soundPath / "levelup.wav").string())) {
-        std::cerr << "Level-up sound failed to load: " << (soundPath / "levelup.wav").string() << std::endl;
-        return -1;
-    } else {
-        levelUpSound.setBuffer(levelUpBuffer);
+// Mevcut durumu çiz; alpha, son iki simülasyon adımı arasındaki interpolasyon oranıdır
+// Draw the current state; alpha is the interpolation factor between the last two simulation steps
+void renderGame(const RenderSnapshot& view, float alpha) {
+    // Dynamic background color
+    renderer->beginFrame(
+        view.backgroundColor * 0.2f,
+        view.backgroundColor * 0.1f,
+        0.3f + view.backgroundColor * 0.2f
+    );
+
+    // Game state handling
+    if (!view.gameStarted) {
+        // Welcome screen - just blue background
+        // Nothing will be drawn
     }
+    else if (view.gameOver) {
+        // Game over screen - just blue background
+        // Nothing will be drawn
+    }
+    else if (!view.isPaused) {
+        ProfileScope stage(&profiler, ProfileStage::DrawBlocks);
+
+        // Active gameplay
+        // Draw player
+        const float playerX = view.previousPlayerX + (view.playerX - view.previousPlayerX) * alpha;
+        if (!view.hasEffect(TimedEffect::Invisibility)) {
+            drawRectangle(playerX, -0.8f, 0.1f, 0.1f, 0.0f, 1.0f, 0.0f);
+        } else {
+            renderer->rect(playerX, -0.8f, 0.1f, 0.1f, 0.0f, 1.0f, 0.0f, 0.5f); // Semi-transparent green
+        }
 
-    if (!gameOverBuffer.loadFromFile((soundPath / "gameover.wav").string())) {
-        std::cerr << "Game-over sound failed to load: " << (soundPath / "gameover.wav").string() << std::endl;
-        return -1;
+        if (spriteRenderer.isAvailable()) {
+            // Tüm power-up'lar tek örneklemeli çizim çağrısıyla => // All power-ups in one instanced draw call
+            spriteRenderer.begin();
+            const auto& positions = view.powerUps.get<Position>();
+            const auto& previous = view.powerUps.get<PrevPosition>();
+            const auto& kinds = view.powerUps.get<PowerUpKind>();
+            for (size_t i = 0; i < view.powerUps.size(); i++) {
+                spriteRenderer.addPowerUp(kinds[i].type,
+                                          previous[i].x + (positions[i].x - previous[i].x) * alpha,
+                                          previous[i].y + (positions[i].y - previous[i].y) * alpha);
+            }
+            spriteRenderer.flush();
+        } else {
+            const auto& positions = view.powerUps.get<Position>();
+            const auto& previous = view.powerUps.get<PrevPosition>();
+            const auto& kinds = view.powerUps.get<PowerUpKind>();
+            for (size_t i = 0; i < view.powerUps.size(); i++) {
+                Position drawn = {
+                    previous[i].x + (positions[i].x - previous[i].x) * alpha,
+                    previous[i].y + (positions[i].y - previous[i].y) * alpha
+                };
+
+                // PowerUp çizimini try-catch içine al => // Put PowerUp drawing in try-catch block
+                try {
+                    drawPowerUp(drawn, kinds[i].type);
+                } catch (...) {
+                    std::cerr << "Error drawing powerup" << std::endl;
+                }
+            }
+        }
+
+        // Visual effect to show time slow
+        if (view.hasEffect(TimedEffect::TimeSlow)) {
+            drawOverlay(0.0f, 0.4f, 0.8f, 0.2f);
+        }
+
+        // Draw shield around player
+        if (view.hasEffect(TimedEffect::Shield)) {
+            const int segments = 20;
+            drawFan(playerX + 0.05f, -0.85f, 0.15f, UNIT_CIRCLE<segments>, 0.3f, 0.8f, 1.0f, 0.5f);
+        }
+
+        if (spriteRenderer.isAvailable()) {
+            // Tüm bloklar tek örneklemeli çizim çağrısıyla => // All blocks in one instanced draw call
+            spriteRenderer.begin();
+            const auto& positions = view.blocks.get<Position>();
+            const auto& previous = view.blocks.get<PrevPosition>();
+            const auto& shapes = view.blocks.get<BlockShape>();
+            const auto& movements = view.blocks.get<Movement>();
+            const auto& colors = view.blocks.get<Color>();
+            for (size_t i = 0; i < view.blocks.size(); i++) {
+                spriteRenderer.addBlock(shapes[i].kind, movements[i].pattern, colors[i],
+                                        previous[i].x + (positions[i].x - previous[i].x) * alpha,
+                                        previous[i].y + (positions[i].y - previous[i].y) * alpha);
+            }
+            spriteRenderer.flush();
+        } else {
+            const auto& positions = view.blocks.get<Position>();
+            const auto& previous = view.blocks.get<PrevPosition>();
+            const auto& shapes = view.blocks.get<BlockShape>();
+            const auto& movements = view.blocks.get<Movement>();
+            const auto& colors = view.blocks.get<Color>();
+            for (size_t i = 0; i < view.blocks.size(); i++) {
+                Position drawn = {
+                    previous[i].x + (positions[i].x - previous[i].x) * alpha,
+                    previous[i].y + (positions[i].y - previous[i].y) * alpha
+                };
+                drawBlock(drawn, shapes[i].kind, movements[i].pattern, colors[i]);
+            }
+        }
+
+        stage.next(ProfileStage::DrawParticles);
+        particleRenderer.draw(view.particles);
+
+        stage.next(ProfileStage::DrawHud);
+        drawHud();
     } else {
-        gameOverSound.setBuffer(gameOverBuffer);
+        ProfileScope stage(&profiler, ProfileStage::DrawHud);
+
+        // Paused state
+        drawOverlay(0.0f, 0.0f, 0.0f, 0.7f);
+        drawHud();
+
+        renderText("PAUSED", -measureText("PAUSED", 0.15f) / 2, 0.1f, 0.15f, 1.0f, 1.0f, 1.0f);
+        renderText("Press P to Resume", -measureText("Press P to Resume", 0.08f) / 2, -0.1f, 0.08f, 0.8f, 0.8f, 0.8f);
     }
 
-    // Load background music
-    if (!sigma.openFromFile((soundPath / "sigma.wav").string())) {
-        std::cerr << "Background music failed to load: " << (soundPath / "sigma.wav").string() << std::endl;
-        return -1;
+    // Draw fade overlays
+    if (view.fadeInEffect || view.fadeOutEffect) {
+        drawOverlay(0.0f, 0.0f, 0.0f, view.fadeAlpha);
+    }
+
+    if (showProfiler) {
+        ProfileScope stage(&profiler, ProfileStage::DrawHud);
+        drawProfilerOverlay();
+    }
+}
+
+// Pencere ve bağlamı aç; core istenirse 3.3 core profil ister, GLEW'i yükler
+// Open the window and context; asks for a 3.3 core profile if core is wanted, loads GLEW
+GLFWwindow* createGameWindow(bool coreProfile) {
+    glfwDefaultWindowHints();
+    if (coreProfile) {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE); // macOS bunsuz core vermez => // macOS needs it for core
+    }
+    GLFWwindow* window = glfwCreateWindow(800, 600, "Avoidance Game", NULL, NULL);
+    if (!window) {
+        return nullptr;
+    }
+
+    glfwMakeContextCurrent(window);
+    glewExperimental = GL_TRUE;
+    if (glewInit() != GLEW_OK) {
+        glfwDestroyWindow(window);
+        return nullptr;
+    }
+    // GLEW core profilde glGetString(GL_EXTENSIONS) çağırıp GL_INVALID_ENUM bırakır; temizle
+    // GLEW calls glGetString(GL_EXTENSIONS) on core profiles and leaves GL_INVALID_ENUM; clear it
+    glGetError();
+    return window;
+}
+
+// Tercih edilen arka ucu aç; core bağlam ya da shader'lar olmazsa sabit işlevli yola düş
+// Open the preferred backend; fall back to the fixed-function path without a core context or shaders
+GLFWwindow* createRenderer() {
+    if (preferCoreProfile) {
+        if (GLFWwindow* window = createGameWindow(true)) {
+            if (coreBackend.init()) {
+                renderer = &coreBackend;
+                return window;
+            }
+            coreBackend.release();
+            glfwDestroyWindow(window);
+        }
+        std::cerr << "OpenGL 3.3 core profile unavailable, falling back to the immediate renderer" << std::endl;
+    }
+    GLFWwindow* window = createGameWindow(false);
+    if (window) {
+        immediateBackend.init();
+        renderer = &immediateBackend;
+    }
+    return window;
+}
+
+int main(int argc, char** argv) {
+    // Pencere ve ses olmadan, CPU'nun izin verdiği hızda simülasyon çalıştır
+    // Run the simulation without window or audio, as fast as the CPU allows
+    HeadlessOptions headlessOptions;
+    if (parseHeadlessArgs(argc, argv, headlessOptions)) {
+        return runHeadless(headlessOptions);
+    }
+    jobs = std::make_unique<JobSystem>();
+    game = std::make_unique<GameSimulation>();
+    simThread = std::make_unique<SimulationThread>(*game);
+
+    // --particles N: parçacık deposu kapasitesi => // Particle store capacity
+    // --seed S: oyunu yeniden üretmek için tohum => // Seed, to reproduce a run
+    // --renderer core|immediate: çizim arka ucu => // Render backend
+    // --frames N: N kareden sonra kapan (ör. Xvfb altında CI) => // Close after N frames (e.g. CI under Xvfb)
+    uint64_t seed = makeRandomSeed();
+    long long maxFrames = 0;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == "--particles") {
+            long long capacity = std::atoll(argv[i + 1]);
+            if (capacity > 0) {
+                game->particles.setCapacity((size_t)capacity);
+            }
+        } else if (std::string(argv[i]) == "--seed") {
+            seed = std::strtoull(argv[i + 1], nullptr, 10);
+        } else if (std::string(argv[i]) == "--vsync") {
+            PacingMode mode;
+            if (!parsePacingMode(argv[i + 1], mode)) {
+                std::cerr << "Unknown --vsync mode: " << argv[i + 1] << " (use on, off or adaptive)" << std::endl;
+                return -1;
+            }
+            pacer.setMode(mode);
+        } else if (std::string(argv[i]) == "--fps") {
+            // Vsync kapalı, sleep+spin sınırlayıcı => // Vsync off, sleep-plus-spin limiter
+            double fps = std::atof(argv[i + 1]);
+            if (fps <= 0.0) {
+                std::cerr << "Invalid --fps value: " << argv[i + 1] << std::endl;
+                return -1;
+            }
+            pacer.setTargetFps(fps);
+            pacer.setMode(PacingMode::Limited);
+        } else if (std::string(argv[i]) == "--renderer") {
+            std::string name = argv[i + 1];
+            if (name != "core" && name != "immediate") {
+                std::cerr << "Unknown --renderer: " << name << " (use core or immediate)" << std::endl;
+                return -1;
+            }
+            preferCoreProfile = (name == "core");
+        } else if (std::string(argv[i]) == "--frames") {
+            maxFrames = std::atoll(argv[i + 1]);
+        } else if (std::string(argv[i]) == "--trace") {
+            tracePath = argv[i + 1];
+        } else if (std::string(argv[i]) == "--record") {
+            recordPath = argv[i + 1];
+        } else if (std::string(argv[i]) == "--replay") {
+            // Kaydı gerçek zamanlı oynat; klavye girdisi yok sayılır => // Play the recording in real time; the keyboard is ignored
+            if (!playback.load(argv[i + 1])) {
+                std::cerr << "Failed to load replay: " << argv[i + 1] << std::endl;
+                return -1;
+            }
+            seed = playback.seed;
+            simThread->setPlayback(&playback);
+            recordPath.clear();
+        }
+    }
+    game->seed(seed);
+    game->profiler = &profiler;
+    game->jobs = jobs.get();
+    particleRenderer.jobs = jobs.get();
+    profiler.enableTrace(!tracePath.empty());
+    recording.seed = seed;
+    if (!recordPath.empty()) {
+        simThread->setRecording(&recording);
+    }
+    std::cout << "Seed: " << seed << " (replay with --seed " << seed << ")" << std::endl;
+    
+    // Başlangıç zamanı: ilk kareye kadar geçen süre raporlanır => // Startup time: time-to-first-frame is reported
+    auto launchTime = std::chrono::steady_clock::now();
+
+    // Sesler pencere açılırken paralel çözülür; bir ses ancak ilk çalındığında beklenir
+    // Sounds are decoded in parallel while the window opens; a sound is only waited for when it first plays
+    AssetLoader assetLoader;
+    std::shared_future<bool> musicReady;
+    const char* SOUND_FILES[] = { "collision.wav", "pickup.wav", "levelup.wav", "gameover.wav", "sigma.wav" };
+
+    // Önce paketlenmiş arşiv (tek open + mmap, kopya yok); yoksa ya da eksikse tek tek dosyalar
+    // Packed archive first (one open + mmap, no copies); loose files if it is missing or incomplete
+    std::string archivePath;
+    bool packed = AssetArchive::findArchive("assets.pak", archivePath) && assetArchive.open(archivePath);
+    for (const char* name : SOUND_FILES) {
+        if (packed && !assetArchive.find(name)) {
+            std::cerr << "Asset archive " << archivePath << " has no " << name << ", using loose files" << std::endl;
+            assetArchive.close();
+            packed = false;
+            break;
+        }
+    }
+
+    if (packed) {
+        std::cout << "Using asset archive: " << std::filesystem::absolute(archivePath).string() << std::endl;
+        auto loadPacked = [&](SoundClip& sound, const char* name) {
+            AssetView view = assetArchive.find(name);
+            assetLoader.load(sound, view.data, view.size, name);
+        };
+        loadPacked(collisionSound, "collision.wav");
+        loadPacked(powerUpSound, "pickup.wav");
+        loadPacked(levelUpSound, "levelup.wav");
+        loadPacked(gameOverSound, "gameover.wav");
+        AssetView music = assetArchive.find("sigma.wav");
+        musicReady = assetLoader.open(sigma, music.data, music.size);
     } else {
-        sigma.setVolume(30.0f);
-        sigma.play();
+        // Define sound directory path
+        std::filesystem::path soundPath;
+    
+        // Check common locations for sound files
+        if (!AssetLoader::findSoundDirectory(soundPath)) {
+            // Try to create sounds directory
+            try {
+                std::filesystem::create_directory("sounds");
+                soundPath = "sounds";
+                std::cout << "Created sounds directory at: " << std::filesystem::absolute(soundPath).string() << std::endl;
+            } catch(const std::exception& e) {
+                std::cerr << "Error creating sounds directory: " << e.what() << std::endl;
+                std::cerr << "Please create a 'sounds' folder in the executable directory." << std::endl;
+                return -1;
+            }
+        }
+    
+        std::cout << "Using sound directory: " << std::filesystem::absolute(soundPath).string() << std::endl;
+    
+        // Check if sound directory exists and contains required files
+        if (!std::filesystem::exists(soundPath) || 
+            !std::filesystem::exists(soundPath / "collision.wav") ||
+            !std::filesystem::exists(soundPath / "pickup.wav") ||
+            !std::filesystem::exists(soundPath / "levelup.wav") ||
+            !std::filesystem::exists(soundPath / "gameover.wav") ||
+            !std::filesystem::exists(soundPath / "sigma.wav")) {
+        
+            std::cerr << "Sound directory missing required files!" << std::endl;
+            // Enable SFML error messages
+            std::cerr << "Please place the following WAV files in " << soundPath.string() << ":" << std::endl;
+            std::cerr << "- collision.wav\n- pickup.wav\n- levelup.wav\n- gameover.wav\n- background.wav\n- sigma.wav" << std::endl;
+            return -1;
+        }
+
+        assetLoader.load(collisionSound, soundPath / "collision.wav");
+        assetLoader.load(powerUpSound, soundPath / "pickup.wav");
+        assetLoader.load(levelUpSound, soundPath / "levelup.wav");
+        assetLoader.load(gameOverSound, soundPath / "gameover.wav");
+        musicReady = assetLoader.open(sigma, soundPath / "sigma.wav");
     }
 
+    // Öncelik: oyun sonu > seviye > power-up > çarpışma; çarpışmalar en fazla 3 ses kullanır
+    // Priority: game over > level up > power-up > collision; collisions use at most 3 voices
+    collisionClip = voicePool.addClip(collisionSound, 0, 3);
+    powerUpClip = voicePool.addClip(powerUpSound, 1, 2);
+    levelUpClip = voicePool.addClip(levelUpSound, 2, 1);
+    gameOverClip = voicePool.addClip(gameOverSound, 3, 1);
+
     if (!glfwInit()) {
         std::cerr << "Failed to initialize GLFW!" << std::endl;
         return -1;
     }
 
-    GLFWwindow* window = glfwCreateWindow(800, 600, "Avoidance Game", NULL, NULL);
+    GLFWwindow* window = createRenderer();
     if (!window) {
         std::cerr << "Failed to create window!" << std::endl;
         glfwTerminate();
         return -1;
     }
+    std::cout << "Renderer: " << renderer->name() << " | " << glGetString(GL_RENDERER)
+              << " | OpenGL " << glGetString(GL_VERSION) << std::endl;
+
+    // Sürücü varsayılanına bırakma; takas aralığını açıkça seç
+    // Do not leave it to the driver default; choose the swap interval explicitly
+    adaptiveVsyncSupported = glfwExtensionSupported("WGL_EXT_swap_control_tear") ||
+                             glfwExtensionSupported("GLX_EXT_swap_control_tear");
+    applyPacing();
+
+    // Parçacık vertex/index buffer'larını tam kapasiteyle bir kez ayır
+    particleRenderer.init(renderer, game->particles.capacity());
+    spriteRenderer.init(renderer);
+    if (!textRenderer.init(renderer)) {
+        std::cerr << "Failed to upload font atlas, using rectangle text" << std::endl;
+    }
 
-    glfwMakeContextCurrent(window);
-    glewExperimental = GL_TRUE;
-    if (glewInit() != GLEW_OK) {
-        std::cerr << "Failed to initialize GLEW!" << std::endl;
+    // Müzik açılışta çaldığı için ilk kullanımı burası; yalnızca başlık okunduğundan bekleme kısadır
+    // The music starts at launch, so this is its first use; only the header is read, so the wait is short
+    if (!musicReady.get()) {
+        std::cerr << "Background music failed to load: sigma.wav" << std::endl;
+        glfwDestroyWindow(window);
+        glfwTerminate();
         return -1;
     }
+    sigma.setVolume(30.0f);
+    sigma.play();
 
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
     glfwSetKeyCallback(window, key_callback);
+    glfwSetWindowFocusCallback(window, window_focus_callback);
 
     // Initial state: game should be not started
-    gameStarted = false;
-    gameOver = false;
-    powerUps.clear();
-    blocks.clear(); // Clear the blocks
+    game->gameStarted = false;
+    game->gameOver = false;
+    game->powerUps.clear();
+    game->blocks.clear(); // Clear the blocks
     // When game is first launched, just set variables instead of calling resetGame
     // resetGame(); - Remove this call
 
+    // Simülasyon kendi iş parçacığında sabit adımlarla ilerler; bu döngü yalnızca en
+    // son görüntüyü çizer. Çizim, son adım sınırından geçen süreyle iki adım arasında
+    // interpolasyon yapar.
+    // The simulation advances in fixed steps on its own thread; this loop only draws
+    // the latest snapshot. Rendering interpolates between the last two steps using the
+    // time since the last step boundary.
+    simThread->start();
+
+    // Simülasyon maliyetini çizimden ayrı ölç => // Measure simulation cost separately from rendering
+    uint64_t statsSteps = simThread->stepCount();
+    uint64_t statsBusyNs = simThread->busyNanoseconds();
+    int renderedFrames = 0;
+    long long totalFrames = 0;
+    bool firstFrameShown = false;
+    double statsStartTime = glfwGetTime();
+
     // Daha agresif exception handling => // More aggressive exception handling
     while (!glfwWindowShouldClose(window)) {
         try {
-            // Main loop başlangıcında vektörleri kontrol et ve sınırla => // Check and limit vectors at the beginning of main loop
-            if (blocks.size() > MAX_BLOCKS) {
-                blocks.resize(MAX_BLOCKS);
-            }
-            
-            if (powerUps.size() > 10) {
-                powerUps.resize(10);
-            }
-            
-            if (particles.size() > MAX_PARTICLES) {
-                particles.resize(MAX_PARTICLES);
+            // Sınırlayıcı kipinde kare zamanını bekle; en yeni görüntü ve girdi beklemeden sonra okunur
+            // In limiter mode wait for the frame time; the newest snapshot and input are read after the wait
+            {
+                ProfileScope pacing(&profiler, ProfileStage::Pacing);
+                pacer.waitForNextFrame();
             }
+            // Önceki karenin örneklerini topla, sonra bu kareyi ölçmeye başla
+            // Collect the previous frame's samples, then start timing this one
+            profiler.collect();
+            ProfileScope frameScope(&profiler, ProfileStage::Frame);
+            ProfileScope stage(&profiler, ProfileStage::Render);
 
-            // Mevcut main loop kodu => // Current main loop code
-            // Music control
-            if (gameStarted && !isPaused && !gameOver && sigma.getStatus() != sf::Music::Status::Playing) {
-                sigma.play();
-            }
-            
-            // Background color animation
-            if (colorIncreasing) {
-                backgroundColor += 0.001f; 
-            } else {
-                backgroundColor -= 0.001f;
-            }
-            
-            if (backgroundColor >= 1.0f) {
-                colorIncreasing = false;
-            }
-            if (backgroundColor <= 0.0f) {
-                colorIncreasing = true;
-            }
-
-            // Dynamic background color
-            glClearColor(
-                backgroundColor * 0.2f,
-                backgroundColor * 0.1f,
-                0.3f + backgroundColor * 0.2f,
-                1.0f
-            );
-            glClear(GL_COLOR_BUFFER_BIT);
-
-            updateWindowTitle(window);
-
-            // Game state handling
-            if (!gameStarted) {
-                // Welcome screen - just blue background
-                // Nothing will be drawn
-            }
-            else if (gameOver) {
-                // Game over screen - just blue background
-                // Nothing will be drawn
-            }
-            else if (!isPaused) {
-                // Active gameplay
-                // Draw player
-                if (!isInvisible) {
-                    drawRectangle(playerX, -0.8f, 0.1f, 0.1f, 0.0f, 1.0f, 0.0f);
-                } else {
-                    glEnable(GL_BLEND);
-                    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                    glColor4f(0.0f, 1.0f, 0.0f, 0.5f); // Semi-transparent green
-                    glBegin(GL_QUADS);
-                        glVertex2f(playerX, -0.8f);
-                        glVertex2f(playerX + 0.1f, -0.8f);
-                        glVertex2f(playerX + 0.1f, -0.9f);
-                        glVertex2f(playerX, -0.9f);
-                    glEnd();
-                    glDisable(GL_BLEND);
-                }
+            double currentTime = glfwGetTime();
 
-                // PowerUp oluşturma kodu - seviye bazlı ihtimal artışı => // PowerUp creation code - level-based probability increase
-                if (gameStarted && !gameOver) {
-                    // Seviyeye bağlı olarak düşme ihtimalini belirle => // Determine drop probability based on level
-                    int powerUpChance;
-                    if (level <= 3) {
-                        powerUpChance = 500; // 1/500 ihtimal (seviye 3 ve öncesi)
-                    } else if (level <= 5) {
-                        powerUpChance = 300; // 1/300 ihtimal (seviye 4-5)
-                    } else if (level <= 8) {
-                        powerUpChance = 200; // 1/200 ihtimal (seviye 6-8)
-                    } else {
-                        powerUpChance = 100; // 1/100 ihtimal (seviye 9+)
-                    }
-
-                    // Power-up oluştur => // Create power-up
-                    if (rand() % powerUpChance == 0 && powerUps.size() < 10) { // Power-up sayısını sınırlama ekle
-                        // Power-up türü dağılımını seviyeye göre ayarla => // Adjust power-up type distribution based on level
-                        int powerUpType;
-                        int r = rand() % 100;
-                        
-                        if (level <= 3) {
-                            // Temel power-up'lar daha yaygın (1-3) => // Basic power-ups more common (1-3)
-                            powerUpType = (r < 80) ? (rand() % 3 + 1) : (rand() % 3 + 4);
-                        } else if (level <= 6) {
-                            // Dağılım biraz daha dengeli => // Distribution is more balanced
-                            powerUpType = (r < 60) ? (rand() % 3 + 1) : (rand() % 3 + 4);
-                        } else {
-                            // Gelişmiş power-up'lar daha yaygın (4-6) => // Advanced power-ups more common (4-6)
-                            powerUpType = (r < 40) ? (rand() % 3 + 1) : (rand() % 3 + 4);
-                        }
-                        
-                        powerUps.push_back({
-                            (rand() % 200 - 100) / 100.0f, 
-                            1.0f, 
-                            powerUpType, // Belirlenen power-up türü => // Determined power-up type
-                            5.0f  // 5 saniye süre
-                        });
-                    }
-                }
+            // Asla beklemez; yeni adım yoksa önceki görüntü yeniden çizilir
+            // Never waits; without a new step the previous snapshot is drawn again
+            const RenderSnapshot& view = simThread->latest();
+            float alpha = (float)((SimulationThread::clock() - view.stepTime) / SIM_DT);
+            alpha = std::clamp(alpha, 0.0f, 1.0f);
 
-                // PowerUp güncelleme kodunu değiştirin => // Update the PowerUp code
-                for (auto it = powerUps.begin(); it != powerUps.end();) {
-                    // PowerUp'ı güvenli sınırlar içinde tut => // Keep PowerUp within safe boundaries
-                    if (it->y < -1.5f || it->y > 1.5f || it->x < -1.5f || it->x > 1.5f) {
-                        it = powerUps.erase(it);
-                        continue;
-                    }
-                    
-                    it->y -= blockSpeed * (hasTimeSlow ? timeSlowFactor : 1.0f);
-                    
-                    // PowerUp çizimini try-catch içine al => // Put PowerUp drawing in try-catch block
-                    try {
-                        drawPowerUp(*it);
-                    } catch (...) {
-                        std::cerr << "Error drawing powerup" << std::endl;
-                    }
-
-                    // Çarpışma algılama => // Collision detection
-                    float powerUpCenterX = it->x + 0.04f;
-                    float powerUpCenterY = it->y - 0.04f;
-                    float playerCenterX = playerX + 0.05f;
-                    float playerCenterY = -0.85f;
-                    
-                    float dx = powerUpCenterX - playerCenterX;
-                    float dy = powerUpCenterY - playerCenterY;
-                    float distance = sqrt(dx*dx + dy*dy);
-                    
-                    bool collected = (distance < 0.12f);
-                    
-                    if (collected) {
-                        try {
-                            powerUpSound.play();
-                            
-                            switch (it->type) {
-                                case 1: // Speed
-                                    hasSpeedBoost = true;
-                                    speedBoostTimer = 20.0f;
-                                    playerSpeed = originalPlayerSpeed + 0.1f;
-                                    break;
-                                    
-                                case 2: // Block Reset
-                                    hasBlockReset = true;
-                                    blockResetTimer = 20.0f;
-                                    blocks.clear();
-                                    // Yeni bir blok ekle => // Add a new block
-                                    blocks.push_back({
-                                        (rand() % 180 - 90) / 100.0f, // x
-                                        1.0f, // y
-                                        0, // shape
-                                        0.7f, 0.0f, 0.0f, // color
-                                        0, // movement
-                                        0.0f, // timer
-                                        (rand() % 180 - 90) / 100.0f // originX
-                                    });
-                                    break;
-                                    
-                                case 3: // Invisibility
-                                    isInvisible = true;
-                                    invisibilityTimer = 20.0f;
-                                    break;
-                                    
-                                case 4: // Time Slow 
-                                    hasTimeSlow = true;
-                                    timeSlowTimer = 15.0f;
-                                    timeSlowFactor = 0.5f;
-                                    break;
-                                    
-                                case 5: // Shield
-                                    hasShield = true;
-                                    shieldTimer = 10.0f;
-                                    break;
-                                    
-                                case 6: // Extra Life
-                                    health++;
-                                    // Sadece kısıtlı sayıda parçacıklar ekle => // Add only a limited number of particles
-                                    for (int i = 0; i < 5; i++) {
-                                        float angle = (rand() % 360) * 3.14159f / 180.0f;
-                                        createParticle(playerX + 0.05f, -0.8f, 
-                                                     cos(angle)*0.05f, sin(angle)*0.05f, 
-                                                     1.0f, 0.2f, 0.4f, 
-                                                     1.0f, 0.5f, 0.02f);
-                                    }
-                                    break;
-                            }
-                            
-                            it = powerUps.erase(it);
-                        }
-                        catch (...) {
-                            std::cerr << "Error processing powerup" << std::endl;
-                            ++it; // Yine de ilerlemeliyiz => // We still need to proceed
-                        }
-                    }
-                    else if (it->y < -1.0f) {
-                        it = powerUps.erase(it);
-                    }
-                    else {
-                        ++it;
-                    }
-                }
+            playSoundEvents();
+            syncAudio(view);
 
-                // Update power-up timers
-                if (hasSpeedBoost) {
-                    speedBoostTimer -= 0.016f;
-                    if (speedBoostTimer <= 0) {
-                        hasSpeedBoost = false;
-                        playerSpeed = originalPlayerSpeed;
-                    }
-                }
-
-                if (hasBlockReset) {
-                    blockResetTimer -= 0.016f;
-                    if (blockResetTimer <= 0) {
-                        hasBlockReset = false;
-                        // Restore normal block generation - doğru bir şekilde blokları oluştur => // Restore normal block generation - create blocks properly
-                        blocks.clear(); // İlk önce tüm blokları temizle => // First clear all blocks
-                        for (int i = 0; i < level && i < MAX_BLOCKS; i++) {
-                            float r = 0.7f + ((float)rand() / RAND_MAX) * 0.3f;
-                            float g = 0.0f + ((float)rand() / RAND_MAX) * 0.3f;
-                            float b = 0.0f + ((float)rand() / RAND_MAX) * 0.3f;
-                            
-                            float xPos = (rand() % 200 - 100) / 100.0f;
-                            
-                            blocks.push_back({
-                                xPos,     // x
-                                1.0f + (i * 0.3f), // y - yeni blokların üst üste gelmesini önlemek için aralık bırakın => // leave spacing to prevent new blocks from stacking
-                                rand() % 3, // shape
-                                r, g, b,    // color
-                                (level < 3) ? 0 : rand() % 3, // movement pattern
-                                0.0f,       // movement timer
-                                xPos        // originX
-                            });
-                        }
-                    }
-                }
-
-                if (isInvisible) {
-                    invisibilityTimer -= 0.016f;
-                    if (invisibilityTimer <= 0) {
-                        isInvisible = false;
-                    }
-                }
-
-                // Handle time slow effect
-                if (hasTimeSlow) {
-                    timeSlowTimer -= 0.016f;
-                    if (timeSlowTimer <= 0) {
-                        hasTimeSlow = false;
-                        timeSlowFactor = 1.0f;
-                    } else {
-                        // Visual effect to show time slow
-                        glEnable(GL_BLEND);
-                        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                        glColor4f(0.0f, 0.4f, 0.8f, 0.2f);
-                        glBegin(GL_QUADS);
-                            glVertex2f(-1.0f, 1.0f);
-                            glVertex2f(1.0f, 1.0f);
-                            glVertex2f(1.0f, -1.0f);
-                            glVertex2f(-1.0f, -1.0f);
-                        glEnd();
-                        glDisable(GL_BLEND);
-                    }
-                }
-
-                // Handle shield power-up
-                if (hasShield) {
-                    shieldTimer -= 0.016f;
-                    if (shieldTimer <= 0) {
-                        hasShield = false;
-                    } else {
-                        // Draw shield around player
-                        const int segments = 20;
-                        const float fullCircle = 2.0f * 3.14159f;
-                        
-                        glEnable(GL_BLEND);
-                        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                        glColor4f(0.3f, 0.8f, 1.0f, 0.5f);
-                        glBegin(GL_TRIANGLE_FAN);
-                            glVertex2f(playerX + 0.05f, -0.85f);
-                            float radius = 0.15f;
-                            for (int i = 0; i <= segments; i++) {
-                                float angle = i * fullCircle / segments;
-                                float px = playerX + 0.05f + cos(angle) * radius;
-                                float py = -0.85f + sin(angle) * radius;
-                                glVertex2f(px, py);
-                            }
-                        glEnd();
-                        glDisable(GL_BLEND);
-                        
-                        // Note: Collision handling is now moved inside the block loop
-                        // where the collision variable is defined
-                    }
-                }
+            updateWindowTitle(window, view);
 
-                // In main game loop, use for drawing and updating blocks
-                for (auto& block : blocks) {
-                    // Update block's y position (common for all blocks)
-                    block.y -= blockSpeed * (hasTimeSlow ? timeSlowFactor : 1.0f);
-                    
-                    // Update block's movement based on pattern
-                    updateBlockMovement(block);
-                    
-                    // Draw block
-                    drawBlock(block);
-
-                    // Code at the end of block's fall in main game loop (block.y < -1.0f condition)
-                    if (block.y < -1.0f) {
-                        float xPos = (rand() % 200 - 100) / 100.0f;
-                        block.x = xPos;
-                        block.y = 1.0f;
-                        block.originX = xPos; // Set new origin X
-                        // Assign new shape, color and movement pattern
-                        block.shape = rand() % 3;
-                        block.r = 0.7f + ((float)rand() / RAND_MAX) * 0.3f;
-                        block.g = 0.0f + ((float)rand() / RAND_MAX) * 0.3f;
-                        block.b = 0.0f + ((float)rand() / RAND_MAX) * 0.3f;
-                        
-                        // Only linear movement (0) until level 3
-                        block.movementPattern = (level < 3) ? 0 : rand() % 3;
-                        block.movementTimer = 0.0f;
-                        
-                        // Blok düşüşü sonrası puan güncellemesi => // Score update after block drop
-                        if (!gameOver) {
-                            score++;
-                            
-                            // Level up kodunu daha da güvenceye al - main.cpp dosyasındaki level up işlemi için => // Make level up code even more secure - for level up process in main.cpp
-                            if (score > 0 && score % SCORE_PER_LEVEL == 0) {
-                                try {
-                                    std::cout << "Level up! Score: " << score << ", New level: " << level + 1 << std::endl;
-                                    level++;
-                                    blockSpeed += LEVEL_SPEED_INCREASE;
-                                    
-                                    // Öncelikle, tüm efektleri ve parçacıkları temizle - bu önemli! => // First, clear all effects and particles - this is important!
-                                    particles.clear();
-                                    
-                                    // Level up sound güvenli bir şekilde çal => // Play level up sound safely
-                                    levelUpSound.play();
-                                    
-                                    // Parçacık efekti yaratmayı basitleştir ve sınırla => // Simplify and limit particle effect creation
-                                    float centerX = 0.0f;
-                                    float centerY = 0.0f;
-                                    
-                                    // Sadece 5 basit parçacık yarat => // Create only 5 simple particles
-                                    for (int i = 0; i < 5; i++) {
-                                        float angle = (i * 360.0f / 5) * 3.14159f / 180.0f;
-                                        float vx = cos(angle) * 0.1f;
-                                        float vy = sin(angle) * 0.1f;
-                                        
-                                        // Basit sarı parçacıklar => // Simple yellow particles
-                                        createParticle(centerX, centerY, vx, vy, 
-                                                      1.0f, 1.0f, 0.0f, // yellow
-                                                      1.0f, 0.5f, 0.03f); // alpha, lifetime, size
-                                    }
-                                    
-                                    // Yeni blok ekleme - eğer level 3'e geçiyorsak dikkatli olalım => // Add new block - be careful if transitioning to level 3
-                                    if (level == 3) {
-                                        // Level 3'e geçişte özel güvenlik kontrolü => // Special security check when transitioning to level 3
-                                        std::cout << "Transitioning to level 3 (special handling)" << std::endl;
-                                        
-                                        // Mevcut blokları güvenceye al - çok fazla blok varsa sil => // Secure existing blocks - delete if there are too many
-                                        if (blocks.size() > MAX_BLOCKS / 2) {
-                                            blocks.resize(MAX_BLOCKS / 2);
-                                        }
-                                        
-                                        // Sadece bir adet basit blok ekle => // Add just one simple block
-                                        float xPos = 0.0f; // Merkeze yakın güvenli bir pozisyon => // Safe position near center
-                                        blocks.push_back({
-                                            xPos,      // x
-                                            1.0f,      // y
-                                            0,         // shape - square (simplest)
-                                            1.0f, 0.0f, 0.0f, // red
-                                            0,         // hareket - doğrusal (en basit) => // movement - linear (simplest)
-                                            0.0f,      // timer
-                                            xPos       // originX
-                                        });
-                                    }
-                                    // Diğer levellar için normal blok eklemeyi kullan => // Use normal block addition for other levels
-                                    else if (blocks.size() < MAX_BLOCKS) {
-                                        float xPos = (rand() % 180 - 90) / 100.0f;
-                                        blocks.push_back({
-                                            xPos, 1.0f, 
-                                            0, // shape
-                                            0.7f, 0.0f, 0.0f, // color
-                                            (level < 3) ? 0 : (rand() % 2), // Bazı hareket çeşitlerini sınırla => // Limit some movement types
-                                            0.0f, xPos
-                                        });
-                                    }
-                                }
-                                catch (const std::exception& e) {
-                                    std::cerr << "CRITICAL - Level up exception: " << e.what() << std::endl;
-                                    // Kritik hata - minimum güvenlik önlemleri => // Critical error - minimum security measures
-                                    level++; // Yine de level'ı artır => // Still increase the level
-                                }
-                                catch (...) {
-                                    std::cerr << "CRITICAL - Unknown level up exception" << std::endl;
-                                    level++; // Yine de level'ı artır => // Still increase the level
-                                }
-                            } else {
-                                blockSpeed += NORMAL_SPEED_INCREASE;
-                            }
-                        }
-                    }
-
-                    // Adjust collision detection based on different shapes
-                    bool collision = false;
-
-                    // Çarpışma algılaması öncesi sınır kontrolü => // Boundary check before collision detection
-                    if (block.y >= -1.5f && block.y <= 1.5f && 
-                        block.x >= -1.5f && block.x <= 1.5f) {
-                        
-                        // Çarpışma kontrolünü basitleştirin => // Simplify collision check
-                        float blockCenterX = block.x + 0.05f;
-                        float blockCenterY = block.y - 0.05f;
-                        float playerCenterX = playerX + 0.05f;
-                        float playerCenterY = -0.85f;
-                        
-                        // İki merkezin uzaklığını hesapla => // Calculate distance between two centers
-                        float dx = blockCenterX - playerCenterX;
-                        float dy = blockCenterY - playerCenterY;
-                        float distance = sqrt(dx*dx + dy*dy);
-                        
-                        // Basitleştirilmiş çarpışma kontrolü => // Simplified collision detection
-                        collision = (distance < 0.1f);
-                    }
-                    
-                    // When resetting block after collision
-                    if (collision) {
-                        if (!isInvisible) {
-                            // Check if shield is active
-                            if (hasShield) {
-                                // Just disable shield instead of taking damage
-                                hasShield = false;
-                                shieldTimer = 0.0f;
-                                // Shield breaking effect
-                                createShieldBreakEffect(playerX + 0.05f, -0.85f);
-                            } else {
-                                // No shield, take damage
-                                health--;
-                                collisionSound.play();
-                                
-                                // Add collision animation
-                                createBlockExplosion(block.x + 0.05f, block.y - 0.05f, block.r, block.g, block.b);
-                                
-                                if (health <= 0) {
-                                    gameOverSound.play();
-                                    sigma.stop();
-                                    gameOver = true;
-                                    fadeOutEffect = true;
-                                    fadeAlpha = 0.0f;
-                                }
-                            }
-                        }
-                        
-                        // Reset block position regardless of invisibility or shield
-                        float xPos = (rand() % 200 - 100) / 100.0f;
-                        block.x = xPos;
-                        block.y = 1.0f;
-                        block.originX = xPos;
-                        
-                        // Assign new shape, color and movement pattern
-                        block.shape = rand() % 3;
-                        // Only linear movement (0) until level 3
-                        block.movementPattern = (level < 3) ? 0 : rand() % 3;
-                        block.movementTimer = 0.0f;
-                        block.r = 0.7f + ((float)rand() / RAND_MAX) * 0.3f;
-                        block.g = 0.0f + ((float)rand() / RAND_MAX) * 0.3f;
-                        block.b = 0.0f + ((float)rand() / RAND_MAX) * 0.3f;
-                    }
-                }
+            renderGame(view, alpha);
+            renderer->endFrame();
 
-                // Update and draw particles
-                updateParticles(0.016f);
-                drawParticles();
-            } else {
-                // Paused state
-                glEnable(GL_BLEND);
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                glColor4f(0.0f, 0.0f, 0.0f, 0.7f);
-                glBegin(GL_QUADS);
-                    glVertex2f(-1.0f, 1.0f);
-                    glVertex2f(1.0f, 1.0f);
-                    glVertex2f(1.0f, -1.0f);
-                    glVertex2f(-1.0f, -1.0f);
-                glEnd();
-                glDisable(GL_BLEND);
-                
-                renderText("PAUSED", -0.2f, 0.1f, 0.15f, 1.0f, 1.0f, 1.0f);
-                renderText("Press P to Resume", -0.4f, -0.1f, 0.08f, 0.8f, 0.8f, 0.8f);
+            stage.next(ProfileStage::Swap);
+            glfwSwapBuffers(window);
+            // Takas döndüğünde bu görüntüdeki girdiler ekranda sayılır
+            // Once the swap returns the inputs in this snapshot count as on screen
+            uint64_t swapNs = Profiler::now();
+            inputLatency.presented(view.inputSerial, swapNs, &profiler);
+            pacer.frameFinished(swapNs);
+            if (!firstFrameShown) {
+                firstFrameShown = true;
+                std::cout << "First frame after "
+                          << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - launchTime).count()
+                          << " ms" << std::endl;
             }
-
-            // Handle fade effects
-            if (fadeInEffect) {
-                fadeAlpha -= 0.01f;
-                if (fadeAlpha <= 0.0f) {
-                    fadeAlpha = 0.0f;
-                    fadeInEffect = false;
-                }
-                
-                // Draw black overlay
-                glEnable(GL_BLEND);
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                glColor4f(0.0f, 0.0f, 0.0f, fadeAlpha);
-                glBegin(GL_QUADS);
-                    glVertex2f(-1.0f, 1.0f);
-                    glVertex2f(1.0f, 1.0f);
-                    glVertex2f(1.0f, -1.0f);
-                    glVertex2f(-1.0f, -1.0f);
-                glEnd();
-                glDisable(GL_BLEND);
+            stage.next(ProfileStage::Input);
+            glfwPollEvents();
+            if (maxFrames > 0 && ++totalFrames >= maxFrames) {
+                glfwSetWindowShouldClose(window, GL_TRUE);
             }
 
-            if (fadeOutEffect) {
-                fadeAlpha += 0.01f;
-                if (fadeAlpha >= 1.0f) {
-                    fadeAlpha = 1.0f;
-                    fadeOutEffect = false;
+            // Her 5 saniyede simülasyon maliyetini raporla => // Report simulation cost every 5 seconds
+            renderedFrames++;
+            if (currentTime - statsStartTime >= 5.0) {
+                double elapsed = currentTime - statsStartTime;
+                uint64_t steps = simThread->stepCount() - statsSteps;
+                uint64_t busyNs = simThread->busyNanoseconds() - statsBusyNs;
+                std::cout << "Render: " << renderedFrames / elapsed << " FPS"
+                          << " | Sim: " << steps / elapsed << " steps/s, "
+                          << (steps > 0 ? busyNs / 1000.0 / steps : 0.0) << " us/step";
+                if (inputLatency.sampleCount() > 0) {
+                    std::cout << " | Input->photon: p50 " << inputLatency.percentileMs(0.5f)
+                              << " p95 " << inputLatency.percentileMs(0.95f)
+                              << " p99 " << inputLatency.percentileMs(0.99f) << " ms";
                 }
-                
-                // Draw black overlay
-                glEnable(GL_BLEND);
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                glColor4f(0.0f, 0.0f, 0.0f, fadeAlpha);
-                glBegin(GL_QUADS);
-                    glVertex2f(-1.0f, 1.0f);
-                    glVertex2f(1.0f, 1.0f);
-                    glVertex2f(1.0f, -1.0f);
-                    glVertex2f(-1.0f, -1.0f);
-                glEnd();
-                glDisable(GL_BLEND);
+                printPacingStats(" | ");
+                std::cout << std::endl;
+                statsSteps += steps;
+                statsBusyNs += busyNs;
+                renderedFrames = 0;
+                statsStartTime = currentTime;
             }
-
-            // Debug çıktısını azalt - her karede yazdırma => // Reduce debug output - don't print every frame
-            // Bu satırları kaldırın veya yorum haline getirin
-            /*
-            std::cout << "Blocks: " << blocks.size() 
-                    << ", PowerUps: " << powerUps.size() 
-                    << ", Particles: " << particles.size() 
-                    << ", Health: " << health 
-                    << ", Level: " << level 
-                    << std::endl;
-            */
-
-            glfwSwapBuffers(window);
-            glfwPollEvents();
         }
         catch (const std::exception& e) {
             std::cerr << "EXCEPTION: " << e.what() << std::endl;
-            // Kritik hata - oyunu güvenli bir duruma getir => // Critical error - bring game to a safe state
-            blocks.clear();
-            powerUps.clear();
-            particles.clear();
         }
         catch (...) {
             std::cerr << "UNKNOWN EXCEPTION" << std::endl;
-            blocks.clear();
-            powerUps.clear();
-            particles.clear();
+        }
+    }
+
+    // Bundan sonra oyun durumu yeniden bu iş parçacığına ait => // From here on the game state belongs to this thread again
+    simThread->stop();
+
+    if (inputLatency.totalSamples() > 0) {
+        std::cout << "Input-to-photon latency over the last " << inputLatency.sampleCount() << " of "
+                  << inputLatency.totalSamples() << " inputs: p50 " << inputLatency.percentileMs(0.5f)
+                  << " p95 " << inputLatency.percentileMs(0.95f) << " p99 " << inputLatency.percentileMs(0.99f)
+                  << " ms" << std::endl;
+    }
+    printPacingStats("");
+    std::cout << std::endl;
+    if (simThread->droppedInputCount() > 0 || simThread->droppedSoundCount() > 0) {
+        std::cout << "Queue overflows: " << simThread->droppedInputCount() << " inputs, "
+                  << simThread->droppedSoundCount() << " sound events dropped" << std::endl;
+    }
+
+    if (!recordPath.empty()) {
+        recording.totalSteps = game->stepIndex();
+        recording.finalChecksum = simulationChecksum(*game);
+        if (recording.save(recordPath)) {
+            std::cout << "Recorded " << recording.events.size() << " inputs over " << recording.totalSteps
+                      << " steps to " << recordPath << std::endl;
+        } else {
+            std::cerr << "Failed to write replay: " << recordPath << std::endl;
+        }
+    }
+
+    if (!tracePath.empty()) {
+        profiler.collect();
+        if (profiler.writeChromeTrace(tracePath)) {
+            std::cout << "Wrote trace to " << tracePath << " (open in chrome://tracing or ui.perfetto.dev)" << std::endl;
+        } else {
+            std::cerr << "Failed to write trace: " << tracePath << std::endl;
         }
     }
 
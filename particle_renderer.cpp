@@ -0,0 +1,65 @@
+#include "particle_renderer.h"
+#include "trig_tables.h"
+#include "job_system.h"
+#include <algorithm>
+
+void ParticleRenderer::init(RenderBackend* target, size_t quadCount) {
+    backend = target;
+    vertices.reserve(quadCount * 4);
+    backend->reserveQuads(quadCount);
+}
+
+// [begin, end) parçacıklarının köşelerini döndürüp vertices'e yaz; aralıklar bağımsızdır
+// Rotate the corners of particles [begin, end) into vertices; ranges are independent
+void ParticleRenderer::fillVertices(const ParticleSnapshot& particles, size_t begin, size_t end) {
+    ColorVertex* out = vertices.data() + begin * 4;
+    const float degToRad = 3.14159265f / 180.0f;
+
+    // Dönüşlerin sin/cos'u parça parça vektörel hesaplanır => // Rotation sin/cos is computed in vectorized chunks
+    const size_t CHUNK = 256;
+    float angles[CHUNK], sines[CHUNK], cosines[CHUNK];
+
+    for (size_t start = begin; start < end; start += CHUNK) {
+        size_t chunk = std::min(CHUNK, end - start);
+        for (size_t k = 0; k < chunk; k++) {
+            angles[k] = particles.rotation[start + k] * degToRad;
+        }
+        sinCosBatch(angles, sines, cosines, chunk);
+
+        for (size_t k = 0; k < chunk; k++) {
+            size_t i = start + k;
+            float px = particles.x[i];
+            float py = particles.y[i];
+            float half = particles.sizes[i] * 0.5f;
+            float c = cosines[k] * half;
+            float s = sines[k] * half;
+            uint8_t r = colorByte(particles.r[i]), g = colorByte(particles.g[i]), b = colorByte(particles.b[i]), a = colorByte(particles.a[i]);
+
+            // (-h,-h), (h,-h), (h,h), (-h,h) köşelerinin dönmüş hali
+            out[0] = { px - c + s, py - s - c, r, g, b, a };
+            out[1] = { px + c + s, py + s - c, r, g, b, a };
+            out[2] = { px + c - s, py + s + c, r, g, b, a };
+            out[3] = { px - c - s, py - s + c, r, g, b, a };
+            out += 4;
+        }
+    }
+}
+
+void ParticleRenderer::draw(const ParticleSnapshot& particles) {
+    if (particles.empty() || !backend) {
+        return;
+    }
+
+    // Köşeleri CPU'da döndür ve tek bir diziye yaz; çok parçacıkta çekirdeklere bölünür
+    // Rotate corners on the CPU into one array; split across the cores when there are many
+    vertices.resize(particles.size() * 4);
+    if (jobs) {
+        jobs->parallelFor(particles.size(), FILL_GRAIN, [&](size_t begin, size_t end) {
+            fillVertices(particles, begin, end);
+        });
+    } else {
+        fillVertices(particles, 0, particles.size());
+    }
+
+    backend->quads(vertices.data(), particles.size());
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+// Toplu (batched) parçacık çizici: tüm parçacıklar tek bir vertex buffer'a yazılır
+// ve karışım (blend) durumu bir kez ayarlanarak tek bir çizim çağrısıyla çizilir.
+// Batched particle renderer: every particle is written into one vertex buffer and
+// drawn with a single draw call, with blend state set once.
+
+#include <vector>
+#include <cstddef>
+#include "particle_system.h"
+#include "render_backend.h"
+
+class JobSystem;
+
+class ParticleRenderer {
+public:
+    // Parçacık kopyasını CPU'da döndürülmüş dörtgenler olarak çiz => // Draw a particle snapshot as CPU-rotated quads
+    void draw(const ParticleSnapshot& particles);
+    // Başlangıçta tam kapasite için yer ayır; sonra çizim heap'e dokunmaz
+    // Allocate for full capacity at startup so drawing never touches the heap
+    void init(RenderBackend* target, size_t quadCount);
+
+    // Köşe doldurma bu iş sistemine dağıtılır; nullptr ise tek iş parçacığı
+    // Vertex filling is spread over this job system; single-threaded when nullptr
+    JobSystem* jobs = nullptr;
+
+private:
+    // Paralel doldurmada parça boyutu => // Chunk size of the parallel fill
+    static const size_t FILL_GRAIN = 4096;
+
+    void fillVertices(const ParticleSnapshot& particles, size_t begin, size_t end);
+
+    std::vector<ColorVertex> vertices; // Kare başına yeniden doldurulur, kapasite korunur
+    RenderBackend* backend = nullptr;
+};
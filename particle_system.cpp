@@ -0,0 +1,380 @@
+#include "particle_system.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include "job_system.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// Kare başına sabitler (SIM_DT adımına göre ayarlı) => // Per-step constants (tuned for the SIM_DT step)
+static const float GRAVITY = 0.002f;
+static const float DRAG = 0.98f;
+static const float BOUNDS = 2.0f;
+
+// Tahliye için bakılan yuva sayısı; tam tarama yerine sabit maliyetli örnekleme
+// Slots inspected per eviction; fixed-cost sampling instead of a full scan
+static const size_t EVICTION_SAMPLES = 8;
+
+// Paralel güncellemede parça boyutu; tüm SIMD şerit genişliklerinin katı
+// Chunk size of the parallel update; a multiple of every SIMD lane width
+static const size_t PARALLEL_GRAIN = 8192;
+
+ParticleSystem::ParticleSystem(size_t maxParticles, EvictionPolicy policy)
+    : policy(policy) {
+    setCapacity(maxParticles);
+}
+
+void ParticleSystem::setCapacity(size_t maxParticles) {
+    maxCount = maxParticles;
+    for (std::vector<float>* field : { &x, &y, &vx, &vy, &r, &g, &b, &a,
+                                       &lifetime, &sizes, &rotation, &rotationSpeed }) {
+        field->assign(maxCount, 0.0f);
+        field->shrink_to_fit();
+    }
+    dead.assign(maxCount, 0);
+    birth.assign(maxCount, 0);
+    count = 0;
+    evictCursor = 0;
+}
+
+size_t ParticleSystem::pickVictim() {
+    // Dönen bir imleçten başlayan küçük bir pencereyi örnekle ve en kötü adayı seç
+    // Sample a small window starting at a rotating cursor and take the worst candidate
+    size_t samples = std::min(EVICTION_SAMPLES, count);
+    size_t best = evictCursor % count;
+    float bestScore = 0.0f;
+
+    for (size_t k = 0; k < samples; k++) {
+        size_t i = (evictCursor + k) % count;
+        float score;
+        if (policy == EvictionPolicy::Oldest) {
+            // Yaş; birth sarmalansa bile işaretsiz fark doğru kalır
+            score = (float)(uint32_t)(nextBirth - birth[i]);
+        } else {
+            // Görünürlük ne kadar düşükse skor o kadar yüksek
+            score = -(a[i] * sizes[i]);
+        }
+        if (k == 0 || score > bestScore) {
+            bestScore = score;
+            best = i;
+        }
+    }
+
+    evictCursor = (evictCursor + samples) % count;
+    return best;
+}
+
+bool ParticleSystem::spawn(float px, float py, float pvx, float pvy,
+                           float pr, float pg, float pb, float pa,
+                           float plifetime, float psize, float protation, float protationSpeed) {
+    size_t i;
+    if (count < maxCount) {
+        i = count++;
+    } else if (policy == EvictionPolicy::DropNew || maxCount == 0) {
+        dropped++;
+        return false;
+    } else {
+        i = pickVictim();
+        evicted++;
+    }
+    x[i] = px;
+    y[i] = py;
+    vx[i] = pvx;
+    vy[i] = pvy;
+    r[i] = pr;
+    g[i] = pg;
+    b[i] = pb;
+    a[i] = pa;
+    lifetime[i] = plifetime;
+    sizes[i] = psize;
+    rotation[i] = protation;
+    rotationSpeed[i] = protationSpeed;
+    birth[i] = nextBirth++;
+    return true;
+}
+
+const char* ParticleSystem::kernelName() {
+#if defined(__AVX2__)
+    return "avx2";
+#elif defined(__SSE2__) || defined(_M_X64)
+    return "sse2";
+#elif defined(__ARM_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+// Tek parçacık için referans adım; SIMD yolları bununla aynı sırayı izler
+// Reference step for one particle; the SIMD paths follow the same order
+static inline bool stepParticle(float dt, float& px, float& py, float& pvx, float& pvy,
+                                float& pa, float& plife, float& prot, float protSpeed) {
+    plife -= dt;
+    px += pvx * dt;
+    py += pvy * dt;
+    prot += protSpeed * dt;
+
+    // Yerçekimi ve yavaşlama
+    pvy -= GRAVITY;
+    pvx *= DRAG;
+    pvy *= DRAG;
+
+    // Alpha güncelleme
+    pa = std::min(1.0f, plife);
+
+    // Ömrü biten veya ekran dışına çıkan parçacık ölür
+    return plife <= 0.0f || px < -BOUNDS || px > BOUNDS || py < -BOUNDS || py > BOUNDS;
+}
+
+void ParticleSystem::updateScalar(float deltaTime) {
+    bool anyDead = false;
+    for (size_t i = 0; i < count; i++) {
+        bool isDead = stepParticle(deltaTime, x[i], y[i], vx[i], vy[i], a[i], lifetime[i], rotation[i], rotationSpeed[i]);
+        dead[i] = isDead;
+        anyDead |= isDead;
+    }
+    if (anyDead) {
+        compact();
+    }
+}
+
+// [begin, end) aralığını ilerlet, ölenleri işaretle; ölen varsa sıfırdan farklı döner.
+// begin şerit genişliğinin katı olmalı ki her aralık tek parçalı çalışmayla aynı SIMD
+// gruplarını kullansın (sonuçlar bölmeden bağımsız, bit bit aynı kalır).
+// Advance [begin, end) and flag the dead; returns non-zero if any died. begin must be
+// a multiple of the lane width so every range uses the same SIMD groups as a single
+// pass (results stay bit-identical however the range is split).
+static unsigned integrateRange(float deltaTime, float* px, float* py, float* pvx, float* pvy, float* pa,
+                               float* plife, float* prot, const float* protSpeed, uint8_t* pdead,
+                               size_t begin, size_t end) {
+    size_t i = begin;
+    unsigned anyDead = 0;
+
+#if defined(__AVX2__)
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 gravity = _mm256_set1_ps(GRAVITY);
+    const __m256 drag = _mm256_set1_ps(DRAG);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 bounds = _mm256_set1_ps(BOUNDS);
+    const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+
+    for (; i + 8 <= end; i += 8) {
+        __m256 life = _mm256_sub_ps(_mm256_loadu_ps(plife + i), dt);
+        __m256 velX = _mm256_loadu_ps(pvx + i);
+        __m256 velY = _mm256_loadu_ps(pvy + i);
+        __m256 posX = _mm256_add_ps(_mm256_loadu_ps(px + i), _mm256_mul_ps(velX, dt));
+        __m256 posY = _mm256_add_ps(_mm256_loadu_ps(py + i), _mm256_mul_ps(velY, dt));
+        __m256 rot = _mm256_add_ps(_mm256_loadu_ps(prot + i), _mm256_mul_ps(_mm256_loadu_ps(protSpeed + i), dt));
+
+        velY = _mm256_mul_ps(_mm256_sub_ps(velY, gravity), drag);
+        velX = _mm256_mul_ps(velX, drag);
+
+        _mm256_storeu_ps(plife + i, life);
+        _mm256_storeu_ps(px + i, posX);
+        _mm256_storeu_ps(py + i, posY);
+        _mm256_storeu_ps(pvx + i, velX);
+        _mm256_storeu_ps(pvy + i, velY);
+        _mm256_storeu_ps(prot + i, rot);
+        _mm256_storeu_ps(pa + i, _mm256_min_ps(one, life));
+
+        __m256 deadMask = _mm256_or_ps(
+            _mm256_cmp_ps(life, zero, _CMP_LE_OQ),
+            _mm256_or_ps(_mm256_cmp_ps(_mm256_and_ps(posX, absMask), bounds, _CMP_GT_OQ),
+                         _mm256_cmp_ps(_mm256_and_ps(posY, absMask), bounds, _CMP_GT_OQ)));
+        unsigned bits = (unsigned)_mm256_movemask_ps(deadMask);
+        anyDead |= bits;
+        for (int k = 0; k < 8; k++) {
+            pdead[i + k] = (bits >> k) & 1;
+        }
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 gravity = _mm_set1_ps(GRAVITY);
+    const __m128 drag = _mm_set1_ps(DRAG);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 bounds = _mm_set1_ps(BOUNDS);
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+    for (; i + 4 <= end; i += 4) {
+        __m128 life = _mm_sub_ps(_mm_loadu_ps(plife + i), dt);
+        __m128 velX = _mm_loadu_ps(pvx + i);
+        __m128 velY = _mm_loadu_ps(pvy + i);
+        __m128 posX = _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(velX, dt));
+        __m128 posY = _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(velY, dt));
+        __m128 rot = _mm_add_ps(_mm_loadu_ps(prot + i), _mm_mul_ps(_mm_loadu_ps(protSpeed + i), dt));
+
+        velY = _mm_mul_ps(_mm_sub_ps(velY, gravity), drag);
+        velX = _mm_mul_ps(velX, drag);
+
+        _mm_storeu_ps(plife + i, life);
+        _mm_storeu_ps(px + i, posX);
+        _mm_storeu_ps(py + i, posY);
+        _mm_storeu_ps(pvx + i, velX);
+        _mm_storeu_ps(pvy + i, velY);
+        _mm_storeu_ps(prot + i, rot);
+        _mm_storeu_ps(pa + i, _mm_min_ps(one, life));
+
+        __m128 deadMask = _mm_or_ps(
+            _mm_cmple_ps(life, zero),
+            _mm_or_ps(_mm_cmpgt_ps(_mm_and_ps(posX, absMask), bounds),
+                      _mm_cmpgt_ps(_mm_and_ps(posY, absMask), bounds)));
+        unsigned bits = (unsigned)_mm_movemask_ps(deadMask);
+        anyDead |= bits;
+        pdead[i + 0] = bits & 1;
+        pdead[i + 1] = (bits >> 1) & 1;
+        pdead[i + 2] = (bits >> 2) & 1;
+        pdead[i + 3] = (bits >> 3) & 1;
+    }
+#elif defined(__ARM_NEON)
+    const float32x4_t dt = vdupq_n_f32(deltaTime);
+    const float32x4_t gravity = vdupq_n_f32(GRAVITY);
+    const float32x4_t drag = vdupq_n_f32(DRAG);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t bounds = vdupq_n_f32(BOUNDS);
+
+    for (; i + 4 <= end; i += 4) {
+        float32x4_t life = vsubq_f32(vld1q_f32(plife + i), dt);
+        float32x4_t velX = vld1q_f32(pvx + i);
+        float32x4_t velY = vld1q_f32(pvy + i);
+        float32x4_t posX = vaddq_f32(vld1q_f32(px + i), vmulq_f32(velX, dt));
+        float32x4_t posY = vaddq_f32(vld1q_f32(py + i), vmulq_f32(velY, dt));
+        float32x4_t rot = vaddq_f32(vld1q_f32(prot + i), vmulq_f32(vld1q_f32(protSpeed + i), dt));
+
+        velY = vmulq_f32(vsubq_f32(velY, gravity), drag);
+        velX = vmulq_f32(velX, drag);
+
+        vst1q_f32(plife + i, life);
+        vst1q_f32(px + i, posX);
+        vst1q_f32(py + i, posY);
+        vst1q_f32(pvx + i, velX);
+        vst1q_f32(pvy + i, velY);
+        vst1q_f32(prot + i, rot);
+        vst1q_f32(pa + i, vminq_f32(one, life));
+
+        uint32x4_t deadMask = vorrq_u32(
+            vcleq_f32(life, zero),
+            vorrq_u32(vcagtq_f32(posX, bounds), vcagtq_f32(posY, bounds)));
+        uint32_t lanes[4];
+        vst1q_u32(lanes, deadMask);
+        for (int k = 0; k < 4; k++) {
+            pdead[i + k] = lanes[k] & 1;
+            anyDead |= lanes[k];
+        }
+    }
+#endif
+
+    // Kalan parçacıklar skaler yolda => // Remainder goes through the scalar path
+    for (; i < end; i++) {
+        bool isDead = stepParticle(deltaTime, px[i], py[i], pvx[i], pvy[i], pa[i], plife[i], prot[i], protSpeed[i]);
+        pdead[i] = isDead;
+        anyDead |= isDead;
+    }
+
+    return anyDead;
+}
+
+void ParticleSystem::update(float deltaTime, JobSystem* jobs) {
+    if (count == 0) {
+        return;
+    }
+
+    float* px = x.data();
+    float* py = y.data();
+    float* pvx = vx.data();
+    float* pvy = vy.data();
+    float* pa = a.data();
+    float* plife = lifetime.data();
+    float* prot = rotation.data();
+    const float* protSpeed = rotationSpeed.data();
+    uint8_t* pdead = dead.data();
+
+    unsigned anyDead = 0;
+    if (jobs) {
+        // Parçalar bağımsız; ölüm işaretleri sonra tek iş parçacığında sıkıştırılır
+        // Chunks are independent; the death flags are compacted on one thread afterwards
+        std::atomic<unsigned> deadSeen{0};
+        jobs->parallelFor(count, PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+            if (integrateRange(deltaTime, px, py, pvx, pvy, pa, plife, prot, protSpeed, pdead, begin, end)) {
+                deadSeen.store(1, std::memory_order_relaxed);
+            }
+        });
+        anyDead = deadSeen.load(std::memory_order_relaxed);
+    } else {
+        anyDead = integrateRange(deltaTime, px, py, pvx, pvy, pa, plife, prot, protSpeed, pdead, 0, count);
+    }
+
+    if (anyDead) {
+        compact();
+    }
+}
+
+void ParticleSystem::moveParticle(size_t from, size_t to) {
+    x[to] = x[from];
+    y[to] = y[from];
+    vx[to] = vx[from];
+    vy[to] = vy[from];
+    r[to] = r[from];
+    g[to] = g[from];
+    b[to] = b[from];
+    a[to] = a[from];
+    lifetime[to] = lifetime[from];
+    sizes[to] = sizes[from];
+    rotation[to] = rotation[from];
+    rotationSpeed[to] = rotationSpeed[from];
+    birth[to] = birth[from];
+}
+
+void ParticleSystem::compact() {
+    size_t i = 0;
+    size_t n = count;
+    while (i < n) {
+        if (dead[i]) {
+            // Son parçacığı bu boşluğa taşı; taşınanın kendisi de ölü olabilir
+            // Move the last particle into this hole; it may itself be dead
+            n--;
+            if (i != n) {
+                moveParticle(n, i);
+                dead[i] = dead[n];
+            }
+        } else {
+            i++;
+        }
+    }
+    count = n;
+}
+
+void ParticleSnapshot::reserve(size_t capacity) {
+    for (std::vector<float>* field : { &x, &y, &r, &g, &b, &a, &sizes, &rotation }) {
+        field->assign(capacity, 0.0f);
+    }
+    count = 0;
+}
+
+void ParticleSnapshot::capture(const ParticleSystem& particles, JobSystem* jobs) {
+    count = std::min(particles.size(), x.size());
+    auto copyRange = [&](size_t begin, size_t end) {
+        const size_t n = end - begin;
+        std::copy_n(particles.x.data() + begin, n, x.data() + begin);
+        std::copy_n(particles.y.data() + begin, n, y.data() + begin);
+        std::copy_n(particles.r.data() + begin, n, r.data() + begin);
+        std::copy_n(particles.g.data() + begin, n, g.data() + begin);
+        std::copy_n(particles.b.data() + begin, n, b.data() + begin);
+        std::copy_n(particles.a.data() + begin, n, a.data() + begin);
+        std::copy_n(particles.sizes.data() + begin, n, sizes.data() + begin);
+        std::copy_n(particles.rotation.data() + begin, n, rotation.data() + begin);
+    };
+    if (jobs) {
+        jobs->parallelFor(count, PARALLEL_GRAIN, copyRange);
+    } else {
+        copyRange(0, count);
+    }
+}
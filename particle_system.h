@@ -0,0 +1,115 @@
+#pragma once
+
+// Yapı-dizileri (SoA) düzeninde parçacık deposu.
+// Structure-of-arrays particle store.
+//
+// Her alan kendi bitişik dizisinde tutulur; güncelleme çekirdeği bu dizileri
+// SIMD (AVX2 / SSE2 / NEON) ile 4-8 parçacık birden işler. Ölen parçacıklar
+// sonuncuyla yer değiştirilerek (swap-with-last) çıkarılır, yani sıra korunmaz.
+// Every field lives in its own contiguous array; the update kernel processes
+// 4-8 particles at a time with SIMD (AVX2 / SSE2 / NEON). Dead particles are
+// removed by swapping with the last one, so order is not preserved.
+//
+// Tüm diziler başlangıçta kapasiteye göre ayrılır; oyun sırasında heap'e
+// dokunulmaz. Depo dolduğunda yeni parçacık, seçilen politikaya göre eski ya da
+// en az görünen bir parçacığın yerine yazılır.
+// All arrays are allocated up front at full capacity; nothing touches the heap
+// during play. When the store is full a new particle overwrites an old or
+// barely visible one, depending on the eviction policy.
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+class JobSystem;
+
+// Depo doluyken ne yapılacağı => // What to do when the store is full
+enum class EvictionPolicy {
+    DropNew,      // Yeni parçacığı at (eski davranış)
+    Oldest,       // En eski parçacığın yerine yaz
+    LeastVisible  // En az görünen (alfa * boyut) parçacığın yerine yaz
+};
+
+class ParticleSystem {
+public:
+    explicit ParticleSystem(size_t maxParticles, EvictionPolicy policy = EvictionPolicy::LeastVisible);
+
+    // Kapasiteyi değiştir; tüm parçacıkları siler ve bellek ayırır, sadece başlangıçta çağır
+    // Change capacity; clears all particles and allocates, call only at startup
+    void setCapacity(size_t maxParticles);
+    void setEvictionPolicy(EvictionPolicy newPolicy) { policy = newPolicy; }
+
+    // Yeni parçacık ekle; politika DropNew ise ve depo doluysa false döner
+    // Add a particle; returns false only when full and the policy is DropNew
+    bool spawn(float x, float y, float vx, float vy,
+               float r, float g, float b, float a,
+               float lifetime, float size, float rotation, float rotationSpeed);
+
+    // SIMD güncelleme (derleyicinin desteklediği en geniş yol); jobs verilirse parçalar
+    // çekirdeklere dağılır, sonuç tek iş parçacıklı güncellemeyle aynıdır
+    // SIMD update (widest path the compiler allows); with jobs the chunks are spread over
+    // the cores and the result matches the single-threaded update
+    void update(float deltaTime, JobSystem* jobs = nullptr);
+    // Referans skaler güncelleme; SIMD sonuçlarını doğrulamak için => // Reference scalar update, for checking the SIMD results
+    void updateScalar(float deltaTime);
+
+    void clear() { count = 0; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    size_t capacity() const { return maxCount; }
+
+    // İstatistikler => // Statistics
+    uint64_t evictedCount() const { return evicted; }
+    uint64_t droppedCount() const { return dropped; }
+
+    // Derlenmiş SIMD yolunun adı ("avx2", "sse2", "neon", "scalar") => // Name of the compiled SIMD path
+    static const char* kernelName();
+
+    // Alan dizileri; yalnızca [0, size()) aralığı geçerlidir => // Field arrays; only [0, size()) is valid
+    std::vector<float> x, y;          // Pozisyon
+    std::vector<float> vx, vy;        // Hız vektörü
+    std::vector<float> r, g, b, a;    // Renk
+    std::vector<float> lifetime;      // Kalan ömür
+    std::vector<float> sizes;         // Boyut
+    std::vector<float> rotation;      // Dönüş açısı (derece)
+    std::vector<float> rotationSpeed; // Dönüş hızı
+
+private:
+    // dead[i] != 0 olan parçacıkları sonuncuyla değiştirerek çıkar => // Remove particles flagged in dead[] by swapping with the last
+    void compact();
+    void moveParticle(size_t from, size_t to);
+    // Dolu depoda üzerine yazılacak yuvayı seç => // Pick the slot to overwrite when full
+    size_t pickVictim();
+
+    std::vector<uint8_t> dead;
+    std::vector<uint32_t> birth;   // Doğum sırası (Oldest politikası için)
+    size_t count = 0;
+    size_t maxCount = 0;
+    EvictionPolicy policy;
+    uint32_t nextBirth = 0;
+    size_t evictCursor = 0;        // Örnekleme penceresinin başlangıcı
+    uint64_t evicted = 0;
+    uint64_t dropped = 0;
+};
+
+// Çizimin okuduğu alanların kopyası; simülasyon iş parçacığı doldurur, çizim okur.
+// Kapasite bir kez ayrılır, capture() yalnızca canlı aralığı kopyalar.
+// A copy of the fields drawing reads; the simulation thread fills it and the
+// renderer reads it. Capacity is allocated once, capture() copies only the live range.
+class ParticleSnapshot {
+public:
+    void reserve(size_t capacity);
+    void capture(const ParticleSystem& particles, JobSystem* jobs = nullptr);
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    // Alan dizileri; yalnızca [0, size()) aralığı geçerlidir => // Field arrays; only [0, size()) is valid
+    std::vector<float> x, y;
+    std::vector<float> r, g, b, a;
+    std::vector<float> sizes;
+    std::vector<float> rotation;
+
+private:
+    size_t count = 0;
+};
@@ -0,0 +1,133 @@
+#include "profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+static const char* STAGE_NAMES[(size_t)ProfileStage::Count] = {
+    "frame", "input", "simulation", "fades", "powerups", "blocks",
+    "collision", "particles", "render", "draw_blocks", "draw_particles", "draw_hud", "swap", "pacing",
+    "input_to_step", "input_to_photon"
+};
+
+const char* profileStageName(ProfileStage stage) {
+    return (size_t)stage < (size_t)ProfileStage::Count ? STAGE_NAMES[(size_t)stage] : "?";
+}
+
+// İş parçacığı başına küçük numara (ilk kayıtta atanır) => // Small per-thread number, assigned on first record
+static uint8_t threadNumber() {
+    static std::atomic<uint32_t> nextThread{0};
+    thread_local uint8_t number = (uint8_t)nextThread.fetch_add(1);
+    return number;
+}
+
+static const std::chrono::steady_clock::time_point PROFILER_EPOCH = std::chrono::steady_clock::now();
+
+uint64_t Profiler::now() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - PROFILER_EPOCH).count();
+}
+
+Profiler::Profiler() : ring(RING_CAPACITY) {
+    for (auto& stageHistory : history) {
+        stageHistory.assign(FRAME_HISTORY, 0.0f);
+    }
+    scratch.reserve(FRAME_HISTORY);
+}
+
+void Profiler::record(ProfileStage stage, uint64_t startNs, uint64_t endNs) {
+    uint64_t index = head.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = ring[index & (RING_CAPACITY - 1)];
+
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.startNs.store(startNs, std::memory_order_relaxed);
+    slot.durationNs.store(endNs - startNs, std::memory_order_relaxed);
+    slot.info.store((uint32_t)stage | ((uint32_t)threadNumber() << 8), std::memory_order_relaxed);
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+}
+
+void Profiler::collect() {
+    uint64_t end = head.load(std::memory_order_acquire);
+
+    // Okuyucu geride kaldıysa üzerine yazılmış örnekleri atla
+    // Skip samples that were overwritten if the reader fell behind
+    if (end - readIndex > RING_CAPACITY) {
+        lost += end - readIndex - RING_CAPACITY;
+        readIndex = end - RING_CAPACITY;
+    }
+
+    for (; readIndex < end; readIndex++) {
+        const Slot& slot = ring[readIndex & (RING_CAPACITY - 1)];
+        uint64_t expected = 2 * readIndex + 2;
+        if (slot.sequence.load(std::memory_order_acquire) != expected) {
+            // Henüz yazılıyor ya da üzerine yazıldı => // Still being written or already overwritten
+            lost++;
+            continue;
+        }
+        ProfileSample sample;
+        sample.startNs = slot.startNs.load(std::memory_order_relaxed);
+        sample.durationNs = slot.durationNs.load(std::memory_order_relaxed);
+        uint32_t info = slot.info.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != expected) {
+            lost++;
+            continue;
+        }
+        sample.stage = (ProfileStage)(info & 0xFF);
+        sample.thread = (uint8_t)(info >> 8);
+
+        if ((size_t)sample.stage < (size_t)ProfileStage::Count) {
+            currentTotals[(size_t)sample.stage] += sample.durationNs;
+        }
+        if (tracing) {
+            trace.push_back(sample);
+        }
+    }
+
+    // Kareyi kapat: toplamları geçmişe yaz => // Close the frame: push the totals into the history
+    for (size_t s = 0; s < (size_t)ProfileStage::Count; s++) {
+        history[s][historyPos] = currentTotals[s] / 1.0e6f;
+        currentTotals[s] = 0;
+    }
+    historyPos = (historyPos + 1) % FRAME_HISTORY;
+    historyCount = std::min(historyCount + 1, FRAME_HISTORY);
+}
+
+float Profiler::percentileMs(ProfileStage stage, float percentile) const {
+    if (historyCount == 0) {
+        return 0.0f;
+    }
+    const std::vector<float>& values = history[(size_t)stage];
+    scratch.assign(values.begin(), values.begin() + historyCount);
+    size_t k = std::min(historyCount - 1, (size_t)(percentile * (historyCount - 1) + 0.5f));
+    std::nth_element(scratch.begin(), scratch.begin() + k, scratch.end());
+    return scratch[k];
+}
+
+void Profiler::frameHistoryMs(std::vector<float>& out) const {
+    out.clear();
+    const std::vector<float>& frames = history[(size_t)ProfileStage::Frame];
+    size_t start = (historyPos + FRAME_HISTORY - historyCount) % FRAME_HISTORY;
+    for (size_t i = 0; i < historyCount; i++) {
+        out.push_back(frames[(start + i) % FRAME_HISTORY]);
+    }
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) const {
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        return false;
+    }
+
+    // Chrome trace "complete" olayları (ph: X), zamanlar mikro saniye
+    // Chrome trace "complete" events (ph: X), times in microseconds
+    std::fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (size_t i = 0; i < trace.size(); i++) {
+        const ProfileSample& sample = trace[i];
+        std::fprintf(file, "{\"name\":\"%s\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}%s\n",
+                     profileStageName(sample.stage), sample.startNs / 1000.0, sample.durationNs / 1000.0,
+                     (unsigned)sample.thread, i + 1 < trace.size() ? "," : "");
+    }
+    std::fprintf(file, "]}\n");
+    return std::fclose(file) == 0;
+}
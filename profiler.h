@@ -0,0 +1,135 @@
+#pragma once
+
+// Aşama bazlı kare profilleyici.
+// Per-stage frame profiler.
+//
+// Ölçülen her aşama (girdi, power-up, blok, çarpışma, parçacık, çizim, swap ...)
+// kilitsiz bir halka tampona (ring buffer) bir örnek yazar; yazarlar birbirini
+// ya da okuyucuyu beklemez. Ana döngü her karede collect() ile yeni örnekleri
+// toplar: kare başına aşama toplamları son FRAME_HISTORY kare için saklanır
+// (grafik ve p50/p99 için) ve istenirse Chrome/Perfetto trace JSON'u için biriktirilir.
+// Every measured stage (input, power-ups, blocks, collision, particles, drawing,
+// swap ...) writes one sample into a lock-free ring buffer; writers never wait on
+// each other or on the reader. The main loop drains new samples with collect()
+// every frame: per-frame stage totals are kept for the last FRAME_HISTORY frames
+// (for the graph and p50/p99) and, if enabled, accumulated for a Chrome/Perfetto
+// trace JSON. No GL dependency.
+
+#include <atomic>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+enum class ProfileStage : uint8_t {
+    Frame,          // Tüm kare
+    Input,          // Girdi uygulama + glfwPollEvents
+    Simulation,     // Tüm step() çağrıları
+    Fades,          // Arka plan rengi ve geçiş efektleri
+    PowerUps,       // Power-up doğma, hareket ve toplama
+    Blocks,         // Blok hareketi ve yeniden doğma
+    Collision,      // Blok-oyuncu çarpışma geçişi
+    Particles,      // updateParticles
+    Render,         // Ses olayları, başlık ve tüm çizim (Draw* aşamalarını içerir)
+    DrawBlocks,     // Oyuncu, power-up ve blok çizimi
+    DrawParticles,  // Parçacık çizimi
+    DrawHud,        // Metin ve overlay
+    Swap,           // glfwSwapBuffers
+    Pacing,         // Kare sınırlayıcı beklemesi
+    InputToStep,    // Tuş olayından uygulandığı adıma (simülasyon iş parçacığı)
+    InputToPhoton,  // Tuş olayından o adımı içeren karenin takasına
+    Count
+};
+
+const char* profileStageName(ProfileStage stage);
+
+struct ProfileSample {
+    uint64_t startNs;    // Profiler başlangıcından itibaren
+    uint64_t durationNs;
+    ProfileStage stage;
+    uint8_t thread;      // Küçük iş parçacığı numarası (trace'te tid)
+};
+
+class Profiler {
+public:
+    static const size_t RING_CAPACITY = 1 << 16; // İkinin kuvveti
+    static const size_t FRAME_HISTORY = 240;
+
+    Profiler();
+
+    // Monoton saat (ns) => // Monotonic clock (ns)
+    static uint64_t now();
+
+    // Herhangi bir iş parçacığından çağrılabilir, kilitsiz => // Callable from any thread, lock-free
+    void record(ProfileStage stage, uint64_t startNs, uint64_t endNs);
+
+    // Okuyucu (tek iş parçacığı): yeni örnekleri topla ve kareyi kapat
+    // Reader (single thread): drain new samples and close the frame
+    void collect();
+
+    // Son FRAME_HISTORY karedeki aşama süreleri (ms) => // Stage durations (ms) over the last FRAME_HISTORY frames
+    float percentileMs(ProfileStage stage, float percentile) const;
+    // Kare geçmişi, en eskiden en yeniye (ms) => // Frame history, oldest to newest (ms)
+    void frameHistoryMs(std::vector<float>& out) const;
+
+    // Trace örneklerini biriktirmeye başla => // Start accumulating samples for the trace
+    void enableTrace(bool enabled) { tracing = enabled; }
+    bool writeChromeTrace(const std::string& path) const;
+
+    uint64_t lostSamples() const { return lost; }
+
+private:
+    // Seqlock yuvası: alanlar atomik kelimelerdir, okuyucu yarım yazılmış örneği atar
+    // Seqlock slot: fields are atomic words, the reader discards half-written samples
+    struct Slot {
+        std::atomic<uint64_t> sequence{0}; // 2*i+1 yazılıyor, 2*i+2 hazır
+        std::atomic<uint64_t> startNs{0};
+        std::atomic<uint64_t> durationNs{0};
+        std::atomic<uint32_t> info{0};     // stage | thread << 8
+    };
+
+    std::vector<Slot> ring;
+    std::atomic<uint64_t> head{0};
+    uint64_t readIndex = 0;
+    uint64_t lost = 0;
+
+    // Okuyucu tarafı (collect) => // Reader side (collect)
+    uint64_t currentTotals[(size_t)ProfileStage::Count] = {};
+    std::vector<float> history[(size_t)ProfileStage::Count]; // Halka, ms
+    size_t historyPos = 0;
+    size_t historyCount = 0;
+    mutable std::vector<float> scratch;
+
+    bool tracing = false;
+    std::vector<ProfileSample> trace;
+};
+
+// Kapsam süresini ölçer; next() bir aşamayı bitirip diğerini başlatır.
+// profiler nullptr ise hiçbir şey yapmaz (saat bile okunmaz).
+// Times its scope; next() ends one stage and starts another.
+// Does nothing (not even a clock read) when profiler is nullptr.
+class ProfileScope {
+public:
+    ProfileScope(Profiler* profiler, ProfileStage stage)
+        : profiler(profiler), stage(stage), start(profiler ? Profiler::now() : 0) {}
+    ~ProfileScope() {
+        if (profiler) profiler->record(stage, start, Profiler::now());
+    }
+
+    void next(ProfileStage nextStage) {
+        if (profiler) {
+            uint64_t t = Profiler::now();
+            profiler->record(stage, start, t);
+            start = t;
+        }
+        stage = nextStage;
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    Profiler* profiler;
+    ProfileStage stage;
+    uint64_t start;
+};
@@ -0,0 +1,62 @@
+#include "render_backend.h"
+#include <algorithm>
+
+size_t quadIndexCapacity(size_t currentQuads, size_t wantedQuads) {
+    size_t capacity = std::max<size_t>(currentQuads, 1024);
+    while (capacity < wantedQuads) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+void buildQuadIndices(size_t quadCount, std::vector<uint32_t>& out) {
+    out.resize(quadCount * 6);
+    for (size_t i = 0; i < quadCount; i++) {
+        uint32_t base = (uint32_t)(i * 4);
+        out[i * 6 + 0] = base + 0;
+        out[i * 6 + 1] = base + 1;
+        out[i * 6 + 2] = base + 2;
+        out[i * 6 + 3] = base + 0;
+        out[i * 6 + 4] = base + 2;
+        out[i * 6 + 5] = base + 3;
+    }
+}
+
+void RenderBackend::rect(float x, float y, float width, float height, float r, float g, float b, float a) {
+    const float points[] = {
+        x, y,
+        x + width, y,
+        x + width, y - height,
+        x, y - height,
+    };
+    polygon(points, 4, r, g, b, a);
+}
+
+void RenderBackend::triangle(float x0, float y0, float x1, float y1, float x2, float y2,
+                             float r, float g, float b, float a) {
+    const float points[] = { x0, y0, x1, y1, x2, y2 };
+    polygon(points, 3, r, g, b, a);
+}
+
+void RenderBackend::polygon(const float* points, size_t pointCount, float r, float g, float b, float a) {
+    if (pointCount < 3) {
+        return;
+    }
+    const uint8_t cr = colorByte(r), cg = colorByte(g), cb = colorByte(b), ca = colorByte(a);
+    shapeScratch.clear();
+    for (size_t i = 1; i + 1 < pointCount; i++) {
+        shapeScratch.push_back({ points[0], points[1], cr, cg, cb, ca });
+        shapeScratch.push_back({ points[i * 2], points[i * 2 + 1], cr, cg, cb, ca });
+        shapeScratch.push_back({ points[i * 2 + 2], points[i * 2 + 3], cr, cg, cb, ca });
+    }
+    triangles(shapeScratch.data(), shapeScratch.size());
+}
+
+void RenderBackend::line(float x0, float y0, float x1, float y1, float r, float g, float b, float a) {
+    const uint8_t cr = colorByte(r), cg = colorByte(g), cb = colorByte(b), ca = colorByte(a);
+    const ColorVertex vertices[] = {
+        { x0, y0, cr, cg, cb, ca },
+        { x1, y1, cr, cg, cb, ca },
+    };
+    lines(vertices, 2);
+}
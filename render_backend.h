@@ -0,0 +1,112 @@
+#pragma once
+
+// Çizim arka ucu arayüzü: oyunun kullandığı tüm GL çizimi bu arayüzden geçer.
+// Render backend interface: every GL draw the game makes goes through it.
+//
+// İki uygulama vardır:
+//   GlCoreBackend      - OpenGL 3.3 core profil: VAO/VBO ve shader'lar. Tek renkli
+//                        şekiller kare boyunca tek bir akış buffer'ında biriktirilir
+//                        ve sıra bozulmadan toplu çizilir.
+//   GlImmediateBackend - Eski sabit işlevli yol (glBegin/glEnd, istemci dizileri);
+//                        core bağlam açılamazsa yedek olarak kullanılır.
+// There are two implementations:
+//   GlCoreBackend      - OpenGL 3.3 core profile: VAOs/VBOs and shaders. Solid
+//                        shapes are gathered in one streaming buffer over the frame
+//                        and drawn in batches without changing the draw order.
+//   GlImmediateBackend - The old fixed-function path (glBegin/glEnd, client arrays);
+//                        the fallback when no core context can be created.
+//
+// Koordinatlar normalleştirilmiş cihaz koordinatlarıdır (-1..1), dönüşüm yoktur.
+// Karışım her zaman SRC_ALPHA / ONE_MINUS_SRC_ALPHA'dır; opak renkler (a = 1)
+// karışımsız çizimle aynı pikselleri verir.
+// Coordinates are normalized device coordinates (-1..1) with no transform.
+// Blending is always SRC_ALPHA / ONE_MINUS_SRC_ALPHA; opaque colours (a = 1) give
+// the same pixels as drawing without blending.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "text_layout.h"
+
+struct ColorVertex {
+    float x, y;
+    uint8_t r, g, b, a;
+};
+
+enum SpriteShape {
+    SPRITE_SQUARE = 0,
+    SPRITE_TRIANGLE = 1,
+    SPRITE_CIRCLE = 2,
+    SPRITE_HEART = 3
+};
+
+struct SpriteInstance {
+    float x, y;          // Sol üst köşe
+    float width, height;
+    float r, g, b, a;
+    float shape;         // SpriteShape
+    float brightness;    // Renk çarpanı (hareket desenine göre)
+};
+
+class RenderBackend {
+public:
+    virtual ~RenderBackend() {}
+
+    virtual const char* name() const = 0;
+    // Bağlam bu iş parçacığında güncelken çağır; başarısız olursa stderr'e yazar ve false döner
+    // Call with the context current on this thread; on failure logs to stderr and returns false
+    virtual bool init() = 0;
+    // GL nesnelerini sil (bağlam yok edilmeden önce) => // Delete GL objects (before the context goes away)
+    virtual void release() = 0;
+
+    // Kareyi temizle ve ortak durumu kur => // Clear the frame and set up the shared state
+    virtual void beginFrame(float r, float g, float b) = 0;
+    // Biriken çizimleri gönder; takastan önce çağır => // Submit batched draws; call before the swap
+    virtual void endFrame() = 0;
+
+    // Üçgen listesi => // Triangle list
+    virtual void triangles(const ColorVertex* vertices, size_t count) = 0;
+    virtual void lines(const ColorVertex* vertices, size_t count) = 0;
+    // Her dört köşe (GL_QUADS sırası) iki üçgen olur; büyük diziler için (parçacıklar)
+    // Every four vertices (GL_QUADS order) become two triangles; for large arrays (particles)
+    virtual void quads(const ColorVertex* vertices, size_t quadCount) = 0;
+    // quads() için index buffer'ı önceden büyüt => // Grow the index buffer for quads() up front
+    virtual void reserveQuads(size_t quadCount) = 0;
+
+    // Örneklemeli sprite'lar; desteklenmezse çağıran şekilleri tek tek çizer
+    // Instanced sprites; when unsupported the caller draws the shapes one by one
+    virtual bool supportsSprites() const = 0;
+    virtual void sprites(const SpriteInstance* instances, size_t count) = 0;
+
+    // Tek kanallı font atlası ve önbellekli metin ağları (TextVertex, GL_QUADS sırası)
+    // Single-channel font atlas and cached text meshes (TextVertex, GL_QUADS order)
+    virtual bool loadFont(const uint8_t* pixels, int width, int height) = 0;
+    virtual uint32_t createMesh() = 0; // 0 = başarısız => // 0 = failed
+    virtual void updateMesh(uint32_t mesh, const TextVertex* vertices, size_t count) = 0;
+    virtual void destroyMesh(uint32_t mesh) = 0;
+    // (x, y) kadar ötelenmiş, (r, g, b) renginde => // Translated by (x, y), tinted (r, g, b)
+    virtual void drawText(uint32_t mesh, size_t vertexCount, float x, float y, float r, float g, float b) = 0;
+
+    // Yardımcılar: tek renkli şekiller triangles() üzerinden => // Helpers: solid shapes through triangles()
+    // (x, y) sol üst köşe; dikdörtgen aşağı doğru uzanır => // (x, y) is the top-left corner; the rectangle extends downwards
+    void rect(float x, float y, float width, float height, float r, float g, float b, float a = 1.0f);
+    void triangle(float x0, float y0, float x1, float y1, float x2, float y2, float r, float g, float b, float a = 1.0f);
+    // Dışbükey çokgen, ilk noktadan yelpaze olarak (x, y çiftleri) => // Convex polygon, fanned from the first point (x, y pairs)
+    void polygon(const float* points, size_t pointCount, float r, float g, float b, float a = 1.0f);
+    void line(float x0, float y0, float x1, float y1, float r, float g, float b, float a = 1.0f);
+
+private:
+    std::vector<ColorVertex> shapeScratch;
+};
+
+// quads() için index'ler: dörtgen başına (0, 1, 2, 0, 2, 3). Kapasite ikinin kuvvetlerine
+// yuvarlanır (en az 1024 dörtgen), böylece yeniden oluşturma nadir olur.
+// Indices for quads(): (0, 1, 2, 0, 2, 3) per quad. Capacity is rounded up to a power of
+// two (at least 1024 quads) so rebuilds are rare.
+size_t quadIndexCapacity(size_t currentQuads, size_t wantedQuads);
+void buildQuadIndices(size_t quadCount, std::vector<uint32_t>& out);
+
+// 0..1 rengi bayta çevir => // Convert a 0..1 colour to a byte
+inline uint8_t colorByte(float value) {
+    return (uint8_t)((value < 0.0f ? 0.0f : value > 1.0f ? 1.0f : value) * 255.0f + 0.5f);
+}
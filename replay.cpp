@@ -0,0 +1,147 @@
+#include "replay.h"
+#include <fstream>
+#include <iterator>
+#include <cstring>
+
+static const char REPLAY_MAGIC[4] = { 'S', 'P', 'D', 'R' };
+static const uint32_t REPLAY_VERSION = 1;
+
+static void putU32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; i++) out.push_back((uint8_t)(value >> (i * 8)));
+}
+
+static void putU64(std::vector<uint8_t>& out, uint64_t value) {
+    for (int i = 0; i < 8; i++) out.push_back((uint8_t)(value >> (i * 8)));
+}
+
+static void putVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((uint8_t)value);
+}
+
+// Okuma imleci; taşmada ok = false olur => // Read cursor; sets ok = false on overrun
+struct ByteReader {
+    const std::vector<uint8_t>& data;
+    size_t pos = 0;
+    bool ok = true;
+
+    uint64_t fixed(int bytes) {
+        if (pos + bytes > data.size()) {
+            ok = false;
+            return 0;
+        }
+        uint64_t value = 0;
+        for (int i = 0; i < bytes; i++) value |= (uint64_t)data[pos++] << (i * 8);
+        return value;
+    }
+
+    uint64_t varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos >= data.size()) {
+                ok = false;
+                return 0;
+            }
+            uint8_t byte = data[pos++];
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return value;
+        }
+        ok = false;
+        return 0;
+    }
+};
+
+bool Replay::save(const std::string& path) const {
+    std::vector<uint8_t> out;
+    out.reserve(36 + events.size() * 2);
+    out.insert(out.end(), REPLAY_MAGIC, REPLAY_MAGIC + 4);
+    putU32(out, REPLAY_VERSION);
+    putU64(out, seed);
+    putU64(out, totalSteps);
+    putU64(out, finalChecksum);
+    putU32(out, (uint32_t)events.size());
+
+    uint64_t previousStep = 0;
+    for (const ReplayEvent& event : events) {
+        putVarint(out, event.step - previousStep);
+        out.push_back((uint8_t)event.action);
+        previousStep = event.step;
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    file.write((const char*)out.data(), (std::streamsize)out.size());
+    return (bool)file;
+}
+
+bool Replay::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (data.size() < 4 || std::memcmp(data.data(), REPLAY_MAGIC, 4) != 0) {
+        return false;
+    }
+
+    ByteReader reader{ data, 4 };
+    if (reader.fixed(4) != REPLAY_VERSION) {
+        return false;
+    }
+    seed = reader.fixed(8);
+    totalSteps = reader.fixed(8);
+    finalChecksum = reader.fixed(8);
+    uint64_t count = reader.fixed(4);
+
+    events.clear();
+    uint64_t step = 0;
+    for (uint64_t i = 0; i < count && reader.ok; i++) {
+        step += reader.varint();
+        uint64_t action = reader.fixed(1);
+        if (action < (uint64_t)InputAction::Start || action > (uint64_t)InputAction::RightUp) {
+            return false;
+        }
+        events.push_back({ step, (InputAction)action });
+    }
+    return reader.ok;
+}
+
+static void mix(uint64_t& hash, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+}
+
+template <typename T>
+static void mixValue(uint64_t& hash, const T& value) {
+    mix(hash, &value, sizeof(value));
+}
+
+uint64_t simulationChecksum(const GameSimulation& game) {
+    uint64_t hash = 14695981039346656037ULL;
+    mixValue(hash, game.stepIndex());
+    mixValue(hash, game.score);
+    mixValue(hash, game.level);
+    mixValue(hash, game.health);
+    mixValue(hash, game.gameOver);
+    mixValue(hash, game.isPaused);
+    mixValue(hash, game.playerX);
+    mixValue(hash, game.playerSpeed);
+    mixValue(hash, game.blockSpeed);
+    for (size_t i = 0; i < game.blocks.size(); i++) {
+        mixValue(hash, game.blocks.at<Position>(i).x);
+        mixValue(hash, game.blocks.at<Position>(i).y);
+        mixValue(hash, game.blocks.at<BlockShape>(i).kind);
+        mixValue(hash, game.blocks.at<Movement>(i).pattern);
+    }
+    for (size_t i = 0; i < game.powerUps.size(); i++) {
+        mixValue(hash, game.powerUps.at<Position>(i).x);
+        mixValue(hash, game.powerUps.at<Position>(i).y);
+        mixValue(hash, game.powerUps.at<PowerUpKind>(i).type);
+    }
+    return hash;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+// Girdi kaydı ve tekrarı (replay).
+// Input recording and replay.
+//
+// Simülasyon deterministiktir: aynı tohum ve aynı adımlarda uygulanan aynı
+// girdiler aynı oyunu üretir. Bu yüzden bir oturumu yeniden oynatmak için yalnızca
+// tohum ve (adım indeksi, girdi) çiftleri saklanır. Dosyanın sonunda kaydedilen
+// oturumun son durum özeti (checksum) bulunur; tekrar bununla doğrulanır.
+// The simulation is deterministic: the same seed with the same inputs applied at
+// the same steps produces the same game. So only the seed and (step index, input)
+// pairs are stored to re-run a session. The file ends with a checksum of the
+// recorded session's final state, which the replay is verified against.
+//
+// Dosya biçimi (little-endian) => // File format (little-endian):
+//   "SPDR" | u32 sürüm | u64 tohum | u64 adım sayısı | u64 checksum | u32 olay sayısı
+//   her olay: LEB128 adım farkı + u8 InputAction => // each event: LEB128 step delta + u8 InputAction
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "game_simulation.h"
+
+struct ReplayEvent {
+    uint64_t step;       // Girdinin uygulandığı step() indeksi (o adımdan hemen önce)
+    InputAction action;
+};
+
+struct Replay {
+    uint64_t seed = 0;
+    uint64_t totalSteps = 0;    // Kaydedilen oturumun uzunluğu
+    uint64_t finalChecksum = 0; // simulationChecksum() totalSteps adım sonra
+    std::vector<ReplayEvent> events;
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+};
+
+// Oyun durumunun (parçacıklar hariç) FNV-1a özeti => // FNV-1a digest of the game state (excluding particles)
+uint64_t simulationChecksum(const GameSimulation& game);
+
+// Kayıttaki olayları sırayla, adımları geldikçe veren imleç
+// Cursor that hands out the recorded events in order as their steps come up
+class ReplayPlayer {
+public:
+    explicit ReplayPlayer(const Replay& replay) : replay(replay) {}
+
+    // Bu adımda uygulanacak bir sonraki olay varsa true döner
+    // Returns true if there is another event to apply at this step
+    bool next(uint64_t step, InputAction& action) {
+        if (cursor < replay.events.size() && replay.events[cursor].step == step) {
+            action = replay.events[cursor++].action;
+            return true;
+        }
+        return false;
+    }
+    bool finished(uint64_t step) const { return step >= replay.totalSteps; }
+
+private:
+    const Replay& replay;
+    size_t cursor = 0;
+};
@@ -0,0 +1,29 @@
+#include "rng.h"
+#include <chrono>
+#include <random>
+
+void Rng::fill(float* out, size_t n) {
+    // Durum yerel kopyada tutulur ki derleyici her adımda belleğe yazmasın
+    // State is kept in a local copy so the compiler does not store it every step
+    Rng local = *this;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = local.uniform();
+    }
+    *this = local;
+}
+
+void Rng::fill(float* out, size_t n, float lo, float hi) {
+    Rng local = *this;
+    const float span = hi - lo;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = lo + span * local.uniform();
+    }
+    *this = local;
+}
+
+uint64_t makeRandomSeed() {
+    std::random_device device;
+    uint64_t seed = ((uint64_t)device() << 32) ^ device();
+    seed ^= (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    return seed;
+}
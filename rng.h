@@ -0,0 +1,70 @@
+#pragma once
+
+// Küçük, tohumlanabilir PRNG (PCG32 XSH-RR).
+// Small, seedable PRNG (PCG32 XSH-RR).
+//
+// rand()'ın aksine gizli global durum yoktur: her Rng kendi durumunu taşır ve
+// aynı tohum + akış aynı diziyi üretir. Farklı akışlar (stream) aynı tohumla
+// birbirinden bağımsız diziler verir; simülasyon oyun, doğma ve görsel efektler
+// için ayrı akışlar kullanır, böylece efekt değişiklikleri oyun dizisini bozmaz.
+// Unlike rand() there is no hidden global state: each Rng carries its own state
+// and the same seed + stream produces the same sequence. Different streams give
+// independent sequences from the same seed; the simulation uses separate streams
+// for gameplay, spawning and cosmetic effects so effect changes never perturb
+// the gameplay sequence.
+
+#include <cstdint>
+#include <cstddef>
+
+class Rng {
+public:
+    Rng() { seed(0, 0); }
+    Rng(uint64_t seedValue, uint64_t stream) { seed(seedValue, stream); }
+
+    void seed(uint64_t seedValue, uint64_t stream) {
+        state = 0;
+        increment = (stream << 1) | 1u;
+        next();
+        state += seedValue;
+        next();
+    }
+
+    uint32_t next() {
+        uint64_t old = state;
+        state = old * 6364136223846793005ULL + increment;
+        uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+        uint32_t rot = (uint32_t)(old >> 59);
+        return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+    }
+
+    // [0, n) aralığında tam sayı; % yerine çarpma-kaydırma (düşük bitlere bağlı değil)
+    // Integer in [0, n); multiply-shift instead of % (does not depend on the low bits)
+    int range(int n) {
+        return (int)(((uint64_t)next() * (uint32_t)n) >> 32);
+    }
+    // [lo, hi) => // [lo, hi)
+    int range(int lo, int hi) {
+        return lo + range(hi - lo);
+    }
+
+    // [0, 1) aralığında float (24 bit) => // Float in [0, 1) (24 bits)
+    float uniform() {
+        return (float)(next() >> 8) * (1.0f / 16777216.0f);
+    }
+    float uniform(float lo, float hi) {
+        return lo + (hi - lo) * uniform();
+    }
+
+    // Parçacık patlamaları için toplu üretim: n adet [0, 1) ya da [lo, hi) float
+    // Batched generation for particle bursts: n floats in [0, 1) or [lo, hi)
+    void fill(float* out, size_t n);
+    void fill(float* out, size_t n, float lo, float hi);
+
+private:
+    uint64_t state;
+    uint64_t increment;
+};
+
+// Yeniden üretilebilirlik için yazdırılacak, saat ve donanımdan alınan tohum
+// A seed taken from the clock and hardware, to be printed for reproducibility
+uint64_t makeRandomSeed();
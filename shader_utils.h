@@ -0,0 +1,16 @@
+#pragma once
+
+// Küçük GLSL yardımcıları => // Small GLSL helpers
+
+#include <GL/glew.h>
+#include <utility>
+#include <vector>
+
+// Vertex ve fragment shader'ı derleyip bağla; attribute konumları bağlamadan önce atanır.
+// Hata olursa stderr'e yazar ve 0 döner.
+// Compile and link a vertex + fragment shader; attribute locations are bound before linking.
+// On failure logs to stderr and returns 0.
+GLuint createShaderProgram(const char* name,
+                           const char* vertexSource,
+                           const char* fragmentSource,
+                           const std::vector<std::pair<GLuint, const char*>>& attributes);
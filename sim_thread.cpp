@@ -0,0 +1,234 @@
+#include "sim_thread.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <iostream>
+#include "profiler.h"
+
+SimulationThread::SimulationThread(GameSimulation& game) : game(game) {}
+
+SimulationThread::~SimulationThread() {
+    stop();
+}
+
+double SimulationThread::clock() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SimulationThread::setPlayback(const Replay* source) {
+    playback = source;
+    if (playback) {
+        replayPlayer.emplace(*playback);
+    } else {
+        replayPlayer.reset();
+    }
+}
+
+void SimulationThread::start() {
+    if (worker.joinable()) {
+        return;
+    }
+    // Oyun sırasında heap'e dokunmamak için her yuvayı tam kapasiteyle ayır
+    // Allocate every slot at full capacity so play never touches the heap
+    const size_t particleCapacity = game.particles.capacity();
+    snapshots.forEachSlot([particleCapacity](RenderSnapshot& snapshot) {
+        snapshot.blocks.reserve(64);
+        snapshot.powerUps.reserve(MAX_POWERUPS * 2);
+        snapshot.particles.reserve(particleCapacity);
+    });
+    // İlk kare başlangıç durumunu görsün => // Let the first frame see the initial state
+    publish(clock());
+
+    running.store(true, std::memory_order_release);
+    worker = std::thread([this] { run(); });
+}
+
+void SimulationThread::stop() {
+    running.store(false, std::memory_order_release);
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+bool SimulationThread::postInput(const InputEvent& event) {
+    if (replayPlayer) {
+        return false;
+    }
+    bool directionKey = true;
+    switch (event.action) {
+        case InputAction::LeftDown: postedKeys |= HELD_LEFT; break;
+        case InputAction::LeftUp: postedKeys &= (uint8_t)~HELD_LEFT; break;
+        case InputAction::RightDown: postedKeys |= HELD_RIGHT; break;
+        case InputAction::RightUp: postedKeys &= (uint8_t)~HELD_RIGHT; break;
+        default: directionKey = false; break;
+    }
+    if (directionKey) {
+        heldKeyState.store(postedKeys, std::memory_order_release);
+    }
+    if (!input.push(event)) {
+        droppedInputs.fetch_add(1, std::memory_order_relaxed);
+        // Düşen kenar, yayınlanan durumdan bir sonraki adımda geri kazanılır
+        // The dropped edge is recovered from the published state on the next step
+        if (directionKey) {
+            keyEdgeDropped.store(true, std::memory_order_release);
+        }
+        return false;
+    }
+    return true;
+}
+
+void SimulationThread::applyInput(const InputEvent& event) {
+    if (event.action == InputAction::ToggleMute && game.gameStarted && !game.gameOver) {
+        muteToggles++;
+    }
+    if (event.serial != 0) {
+        appliedSerial = event.serial;
+        if (game.profiler) {
+            game.profiler->record(ProfileStage::InputToStep, event.timeNs, std::max(event.timeNs, Profiler::now()));
+        }
+    }
+    game.applyInput(event.action);
+}
+
+void SimulationThread::applyQueuedInput(const InputEvent& event) {
+    if (recording) {
+        recording->events.push_back({ game.stepIndex(), event.action });
+    }
+    applyInput(event);
+}
+
+void SimulationThread::advance() {
+    // Girdiler yalnızca adımın başında uygulanır; basılı tuşlar step() içinde örneklenir
+    // Inputs are only applied at the start of a step; held keys are sampled inside step()
+    if (replayPlayer) {
+        InputAction action;
+        while (replayPlayer->next(game.stepIndex(), action)) {
+            applyInput({ action, 0, 0 });
+        }
+    } else {
+        InputEvent event;
+        while (input.pop(event)) {
+            applyQueuedInput(event);
+        }
+        // Kuyruk taştıysa yön tuşlarını yayınlanan duruma eşitle; sentetik kenarlar da kaydedilir.
+        // Bayrak durumdan sonra yazıldığı için okunan durum en az düşen kenar kadar yenidir.
+        // If the queue overflowed, sync the direction keys to the published state; the synthetic
+        // edges are recorded too. The flag is written after the state, so the state read is at
+        // least as new as the dropped edge.
+        if (keyEdgeDropped.exchange(false, std::memory_order_acquire)) {
+            const uint8_t wanted = heldKeyState.load(std::memory_order_acquire);
+            if ((wanted ^ game.heldKeys) & HELD_LEFT) {
+                applyQueuedInput({ (wanted & HELD_LEFT) ? InputAction::LeftDown : InputAction::LeftUp, 0, 0 });
+            }
+            if ((wanted ^ game.heldKeys) & HELD_RIGHT) {
+                applyQueuedInput({ (wanted & HELD_RIGHT) ? InputAction::RightDown : InputAction::RightUp, 0, 0 });
+            }
+        }
+    }
+
+    game.step(SIM_DT);
+
+    // Görüntüler atlanabilir, sesler atlanmamalı; bu yüzden ayrı ve derin bir kuyrukta.
+    // Ön yüz uzun süre boşaltmazsa kuyruk yine de dolabilir; o zaman ses düşer ve sayılır.
+    // Snapshots may be skipped but sounds should not, so they get their own deep queue.
+    // It can still fill up if the front end stops draining it; then the sound is dropped and counted.
+    for (SoundEvent event : game.soundEvents) {
+        if (!sounds.push(event)) {
+            droppedSounds.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    game.soundEvents.clear();
+
+    if (replayPlayer && !replayVerified && replayPlayer->finished(game.stepIndex())) {
+        replayVerified = true;
+        bool match = simulationChecksum(game) == playback->finalChecksum;
+        std::cout << "Replay finished after " << playback->totalSteps << " steps: checksum "
+                  << (match ? "MATCH" : "MISMATCH") << std::endl;
+    }
+}
+
+void SimulationThread::publish(double stepTime) {
+    RenderSnapshot& snapshot = snapshots.back();
+    snapshot.stepIndex = game.stepIndex();
+    snapshot.stepTime = stepTime;
+    snapshot.gameStarted = game.gameStarted;
+    snapshot.gameOver = game.gameOver;
+    snapshot.isPaused = game.isPaused;
+    snapshot.score = game.score;
+    snapshot.health = game.health;
+    snapshot.level = game.level;
+    snapshot.playerX = game.playerX;
+    snapshot.previousPlayerX = game.previousPlayerX;
+    snapshot.backgroundColor = game.backgroundColor;
+    snapshot.fadeInEffect = game.fadeInEffect;
+    snapshot.fadeOutEffect = game.fadeOutEffect;
+    snapshot.fadeAlpha = game.fadeAlpha;
+    snapshot.activeEffects = 0;
+    for (TimedEffect effect : { TimedEffect::SpeedBoost, TimedEffect::BlockReset, TimedEffect::Invisibility,
+                                TimedEffect::TimeSlow, TimedEffect::Shield }) {
+        if (game.hasEffect(effect)) {
+            snapshot.activeEffects |= 1u << (int)effect;
+        }
+    }
+    snapshot.muteToggles = muteToggles;
+    snapshot.inputSerial = appliedSerial;
+    // Kopya atama mevcut kapasiteyi kullanır => // Copy assignment reuses the existing capacity
+    snapshot.blocks = game.blocks;
+    snapshot.powerUps = game.powerUps;
+    snapshot.particles.capture(game.particles, game.jobs);
+    snapshots.publish();
+}
+
+void SimulationThread::run() {
+    // Adım sınırları gerçek zamana sabitlenir; her adım SIM_DT sonra gelir
+    // Step boundaries are pinned to real time; each one comes SIM_DT after the last
+    double nextStep = clock();
+
+    while (running.load(std::memory_order_acquire)) {
+        double now = clock();
+        if (now - nextStep > MAX_SIM_BACKLOG) {
+            nextStep = now - MAX_SIM_BACKLOG;
+        }
+
+        int steps = 0;
+        uint64_t busyStart = Profiler::now();
+        {
+            ProfileScope stage(game.profiler, ProfileStage::Simulation);
+            while (now >= nextStep && steps < MAX_STEPS_PER_WAKE) {
+                try {
+                    advance();
+                } catch (const std::exception& e) {
+                    std::cerr << "EXCEPTION: " << e.what() << std::endl;
+                    // Kritik hata - oyunu güvenli bir duruma getir => // Critical error - bring game to a safe state
+                    game.blocks.clear();
+                    game.powerUps.clear();
+                    game.particles.clear();
+                } catch (...) {
+                    std::cerr << "UNKNOWN EXCEPTION" << std::endl;
+                    game.blocks.clear();
+                    game.powerUps.clear();
+                    game.particles.clear();
+                }
+                nextStep += SIM_DT;
+                steps++;
+            }
+            // Yetişemiyorsak birikmiş adımları at, faz korunur => // Drop the backlog if we cannot keep up, keeping the phase
+            if (steps == MAX_STEPS_PER_WAKE && now >= nextStep) {
+                nextStep += std::ceil((now - nextStep) / SIM_DT) * SIM_DT;
+            }
+            if (steps > 0) {
+                publish(nextStep - SIM_DT);
+            }
+        }
+        if (steps > 0) {
+            stepsTaken.fetch_add((uint64_t)steps, std::memory_order_relaxed);
+            busyNs.fetch_add(Profiler::now() - busyStart, std::memory_order_relaxed);
+        }
+
+        // Bir sonraki adım sınırına kadar uyu; vsync'i hiç beklemez
+        // Sleep until the next step boundary; never waits on vsync
+        std::this_thread::sleep_until(std::chrono::steady_clock::time_point(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(nextStep))));
+    }
+}
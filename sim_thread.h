@@ -0,0 +1,147 @@
+#pragma once
+
+// Simülasyonu kendi iş parçacığında sabit 60 Hz'de çalıştırır.
+// Runs the simulation on its own thread at a fixed 60 Hz.
+//
+// Çizim iş parçacığı oyun durumuna hiç dokunmaz: her adım grubundan sonra
+// simülasyon değişmez bir RenderSnapshot yayınlar (kilitsiz üçlü tampon) ve çizim
+// her karede en yenisini alır. Tuş girdileri ve ses olayları kilitsiz SPSC
+// kuyruklarıyla taşınır. Böylece vsync beklemesi simülasyonu, yavaş bir adım da
+// ekrana basmayı durdurmaz; hiçbir taraf diğerini beklemez.
+// The render thread never touches gameplay state: after each batch of steps the
+// simulation publishes an immutable RenderSnapshot (lock-free triple buffer) and
+// rendering takes the newest one every frame. Key inputs and sound events travel
+// through lock-free SPSC queues. So a vsync wait does not stall the simulation and
+// a slow step does not hold up presenting; neither side ever waits for the other.
+//
+// Girdiler yine adım sınırında uygulanır ve kaydedilir; replay'ler birebir aynıdır.
+// Yön tuşlarının basılı durumu ayrıca atomik olarak yayınlanır: girdi kuyruğu dolup bir
+// bırakma olayı düşerse simülasyon bir sonraki adımda bu duruma eşitlenir, tuş takılı kalmaz.
+// Inputs are still applied and recorded at step boundaries; replays stay bit-exact.
+// The held state of the direction keys is also published atomically: if the input
+// queue fills up and a release edge is dropped, the simulation syncs to that state on
+// the next step, so no key stays stuck.
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include "game_simulation.h"
+#include "input.h"
+#include "replay.h"
+#include "spsc_queue.h"
+#include "triple_buffer.h"
+
+const double MAX_SIM_BACKLOG = 0.25; // Uzun duraklamalardan sonra "ölüm sarmalını" önle
+const int MAX_STEPS_PER_WAKE = 8;    // Bir uyanışta en fazla bu kadar adım çalıştır
+
+// Çizimin ihtiyaç duyduğu her şeyin bir adımdaki kopyası
+// A copy, at one step, of everything rendering needs
+struct RenderSnapshot {
+    uint64_t stepIndex = 0;
+    // Son adım sınırının SimulationThread::clock() zamanı; çizim interpolasyonu buradan ölçülür
+    // SimulationThread::clock() time of the last step boundary; render interpolation is measured from it
+    double stepTime = 0.0;
+
+    // HUD ve ekran durumu => // HUD and screen state
+    bool gameStarted = false;
+    bool gameOver = false;
+    bool isPaused = false;
+    int score = 0;
+    int health = 3;
+    int level = 1;
+    float playerX = 0.0f;
+    float backgroundColor = 0.0f;
+    bool fadeInEffect = false;
+    bool fadeOutEffect = false;
+    float fadeAlpha = 1.0f;
+
+    // Etkin süreli etkiler, TimedEffect başına bir bit => // Active timed effects, one bit per TimedEffect
+    uint32_t activeEffects = 0;
+    bool hasEffect(TimedEffect effect) const { return (activeEffects >> (int)effect) & 1u; }
+
+    // Oyun sırasında uygulanan ToggleMute sayısı; ön yüz farkı kadar sesi açıp kapatır
+    // Number of ToggleMute inputs applied during play; the front end toggles by the difference
+    uint32_t muteToggles = 0;
+    // Bu görüntüye kadar uygulanan son girdinin seri numarası (gecikme ölçümü için)
+    // Serial of the last input applied up to this snapshot (for latency measurement)
+    uint32_t inputSerial = 0;
+    // Önceki adımdaki oyuncu konumu; oyuncu da interpolasyonla çizilir
+    // Player position at the previous step; the player is drawn interpolated too
+    float previousPlayerX = 0.0f;
+
+    BlockArchetype blocks;
+    PowerUpArchetype powerUps;
+    ParticleSnapshot particles;
+};
+
+class SimulationThread {
+public:
+    // start() ile stop() arasında oyun durumu yalnızca bu iş parçacığına aittir
+    // Between start() and stop() the game state belongs to this thread alone
+    explicit SimulationThread(GameSimulation& game);
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    // start()'tan önce: uygulanan girdileri kaydet ya da girdileri kayıttan oynat
+    // Before start(): record the applied inputs, or play the inputs from a recording
+    void setRecording(Replay* target) { recording = target; }
+    void setPlayback(const Replay* source);
+
+    void start();
+    // İş parçacığını durdur ve bekle; sonra oyun durumu yeniden çağırana aittir
+    // Stop the thread and join it; the game state belongs to the caller again afterwards
+    void stop();
+
+    // Çizim iş parçacığı => // Render thread
+    // Girdiyi bir sonraki adımın başı için kuyruğa al; replay oynarken yok sayılır
+    // Queue an input for the start of the next step; ignored while playing a replay
+    bool postInput(const InputEvent& event);
+    bool popSoundEvent(SoundEvent& event) { return sounds.pop(event); }
+    // En son yayınlanan görüntü; asla beklemez => // The latest published snapshot; never blocks
+    const RenderSnapshot& latest() { return snapshots.acquire(); }
+
+    // İstatistikler (her iş parçacığından okunabilir) => // Statistics (readable from any thread)
+    uint64_t stepCount() const { return stepsTaken.load(std::memory_order_relaxed); }
+    uint64_t busyNanoseconds() const { return busyNs.load(std::memory_order_relaxed); }
+    uint64_t droppedInputCount() const { return droppedInputs.load(std::memory_order_relaxed); }
+    uint64_t droppedSoundCount() const { return droppedSounds.load(std::memory_order_relaxed); }
+
+    // Monoton saat (saniye) => // Monotonic clock (seconds)
+    static double clock();
+
+private:
+    void run();
+    // Girdileri uygula ve tek adım ilerle => // Apply inputs and advance one step
+    void advance();
+    void applyInput(const InputEvent& event);
+    // Girdiyi kaydet ve uygula => // Record the input and apply it
+    void applyQueuedInput(const InputEvent& event);
+    void publish(double stepTime);
+
+    GameSimulation& game;
+    Replay* recording = nullptr;
+    const Replay* playback = nullptr;
+    std::optional<ReplayPlayer> replayPlayer;
+    bool replayVerified = false;
+    uint32_t muteToggles = 0;
+    uint32_t appliedSerial = 0;
+
+    SpscQueue<InputEvent, 64> input;
+    // Yön tuşlarının durumu: postedKeys yalnızca çizim iş parçacığında, heldKeyState onun yayını
+    // Direction key state: postedKeys lives on the render thread only, heldKeyState publishes it
+    uint8_t postedKeys = 0;
+    std::atomic<uint8_t> heldKeyState{0};
+    std::atomic<bool> keyEdgeDropped{false};
+    SpscQueue<SoundEvent, 256> sounds;
+    TripleBuffer<RenderSnapshot> snapshots;
+
+    std::thread worker;
+    std::atomic<bool> running{false};
+    std::atomic<uint64_t> stepsTaken{0};
+    std::atomic<uint64_t> busyNs{0};
+    std::atomic<uint64_t> droppedInputs{0};
+    std::atomic<uint64_t> droppedSounds{0};
+};
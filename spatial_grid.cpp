@@ -0,0 +1,82 @@
+#include "spatial_grid.h"
+#include <algorithm>
+#include <cmath>
+
+UniformGrid::UniformGrid(float minX, float minY, float maxX, float maxY, float cellSize)
+    : originX(minX), originY(minY), inverseCellSize(1.0f / cellSize) {
+    cellsX = std::max(1, (int)std::ceil((maxX - minX) * inverseCellSize));
+    cellsY = std::max(1, (int)std::ceil((maxY - minY) * inverseCellSize));
+    cellStart.assign((size_t)cellsX * cellsY + 1, 0);
+    cellFill.assign((size_t)cellsX * cellsY, 0);
+}
+
+void UniformGrid::reserve(size_t maxItems) {
+    itemId.reserve(maxItems);
+    itemX.reserve(maxItems);
+    itemY.reserve(maxItems);
+    itemCell.reserve(maxItems);
+    sortedId.reserve(maxItems);
+    sortedX.reserve(maxItems);
+    sortedY.reserve(maxItems);
+}
+
+void UniformGrid::clear() {
+    itemId.clear();
+    itemX.clear();
+    itemY.clear();
+    itemCell.clear();
+    sortedId.clear();
+    sortedX.clear();
+    sortedY.clear();
+}
+
+int UniformGrid::cellCoordX(float x) const {
+    int cell = (int)std::floor((x - originX) * inverseCellSize);
+    return std::min(std::max(cell, 0), cellsX - 1);
+}
+
+int UniformGrid::cellCoordY(float y) const {
+    int cell = (int)std::floor((y - originY) * inverseCellSize);
+    return std::min(std::max(cell, 0), cellsY - 1);
+}
+
+void UniformGrid::cellRange(float minX, float minY, float maxX, float maxY,
+                            int& minCellX, int& minCellY, int& maxCellX, int& maxCellY) const {
+    minCellX = cellCoordX(minX);
+    minCellY = cellCoordY(minY);
+    maxCellX = cellCoordX(maxX);
+    maxCellY = cellCoordY(maxY);
+}
+
+void UniformGrid::insert(uint32_t id, float x, float y) {
+    itemId.push_back(id);
+    itemX.push_back(x);
+    itemY.push_back(y);
+    itemCell.push_back((uint32_t)(cellCoordY(y) * cellsX + cellCoordX(x)));
+}
+
+void UniformGrid::build() {
+    const size_t count = itemId.size();
+    const size_t cellCount = cellFill.size();
+
+    // Hücre başına say, sonra önek toplamıyla başlangıçları bul
+    // Count per cell, then prefix-sum into start offsets
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+    for (size_t i = 0; i < count; i++) {
+        cellStart[itemCell[i] + 1]++;
+    }
+    for (size_t c = 0; c < cellCount; c++) {
+        cellStart[c + 1] += cellStart[c];
+    }
+
+    sortedId.resize(count);
+    sortedX.resize(count);
+    sortedY.resize(count);
+    std::copy(cellStart.begin(), cellStart.end() - 1, cellFill.begin());
+    for (size_t i = 0; i < count; i++) {
+        uint32_t slot = cellFill[itemCell[i]]++;
+        sortedId[slot] = itemId[i];
+        sortedX[slot] = itemX[i];
+        sortedY[slot] = itemY[i];
+    }
+}
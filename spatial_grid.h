@@ -0,0 +1,107 @@
+#pragma once
+
+// Düzgün ızgara (uniform grid) geniş faz çarpışma yapısı.
+// Uniform-grid collision broadphase.
+//
+// Varlıklar merkez noktalarıyla eklenir ve her adımda sayma sıralamasıyla
+// (counting sort) hücrelere dizilir. Sorgular sadece ilgili hücreleri gezer, bu
+// yüzden maliyet toplam varlık sayısına değil yakındaki varlık sayısına bağlıdır.
+// Entities are inserted by their centre point and bucketed into cells with a
+// counting sort every step. Queries only visit the overlapped cells, so their
+// cost depends on how many entities are nearby, not on the total count.
+//
+// Dünya sınırları dışındaki noktalar kenar hücrelere sıkıştırılır; sonuçlar
+// yine doğrudur, sadece o hücreler kalabalıklaşır.
+// Points outside the world bounds are clamped into the border cells; results
+// stay correct, those cells just get busier.
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class UniformGrid {
+public:
+    UniformGrid(float minX, float minY, float maxX, float maxY, float cellSize);
+
+    // Önceden yer ayır; sonrasında clear/insert/build heap'e dokunmaz
+    // Allocate up front; clear/insert/build then never touch the heap
+    void reserve(size_t maxItems);
+
+    // clear/insert sonrası ızgara build() çağrılana kadar sorgulanamaz
+    // After clear/insert the grid must not be queried until build() runs
+    void clear();
+    void insert(uint32_t id, float x, float y);
+    // Eklenen noktaları hücrelere sırala => // Bucket the inserted points
+    void build();
+
+    size_t size() const { return itemX.size(); }
+
+    // (x, y) noktasına uzaklığı radius'tan küçük tüm varlıkları ziyaret et: visit(id, px, py)
+    // Visit every entity closer than radius to (x, y): visit(id, px, py)
+    template <typename Visitor>
+    void queryRadius(float x, float y, float radius, Visitor&& visit) const {
+        queryRadiusSlots(x, y, radius, [&](size_t slot) {
+            visit(sortedId[slot], sortedX[slot], sortedY[slot]);
+        });
+    }
+
+    // Birbirine radius'tan yakın tüm çiftleri bir kez ziyaret et: visit(idA, idB)
+    // Visit every pair closer than radius exactly once: visit(idA, idB)
+    template <typename Visitor>
+    void forEachPairWithin(float radius, Visitor&& visit) const {
+        const size_t count = sortedId.size();
+        for (size_t k = 0; k < count; k++) {
+            const uint32_t self = sortedId[k];
+            const size_t selfSlot = k;
+            // Sadece sıralı dizide kendinden sonra gelenleri say => // Only count partners that come later in sorted order
+            queryRadiusSlots(sortedX[k], sortedY[k], radius, [&](size_t slot) {
+                if (slot > selfSlot) {
+                    visit(self, sortedId[slot]);
+                }
+            });
+        }
+    }
+
+private:
+    template <typename Visitor>
+    void queryRadiusSlots(float x, float y, float radius, Visitor&& visit) const {
+        int minCellX, minCellY, maxCellX, maxCellY;
+        cellRange(x - radius, y - radius, x + radius, y + radius, minCellX, minCellY, maxCellX, maxCellY);
+        const float radiusSq = radius * radius;
+
+        for (int cy = minCellY; cy <= maxCellY; cy++) {
+            const int row = cy * cellsX;
+            // Bir satırdaki hücreler sıralı dizide bitişiktir => // Cells in a row are contiguous in the sorted arrays
+            const uint32_t begin = cellStart[row + minCellX];
+            const uint32_t end = cellStart[row + maxCellX + 1];
+            for (uint32_t k = begin; k < end; k++) {
+                float dx = sortedX[k] - x;
+                float dy = sortedY[k] - y;
+                if (dx * dx + dy * dy < radiusSq) {
+                    visit((size_t)k);
+                }
+            }
+        }
+    }
+
+    int cellCoordX(float x) const;
+    int cellCoordY(float y) const;
+    void cellRange(float minX, float minY, float maxX, float maxY,
+                   int& minCellX, int& minCellY, int& maxCellX, int& maxCellY) const;
+
+    float originX, originY;
+    float inverseCellSize;
+    int cellsX, cellsY;
+
+    // Eklenen ham noktalar => // Raw inserted points
+    std::vector<uint32_t> itemId;
+    std::vector<float> itemX, itemY;
+    std::vector<uint32_t> itemCell;
+
+    // Hücreye göre sıralanmış noktalar; cellStart[c]..cellStart[c+1] c hücresidir
+    // Points sorted by cell; cellStart[c]..cellStart[c+1] is cell c
+    std::vector<uint32_t> cellStart;
+    std::vector<uint32_t> cellFill;
+    std::vector<uint32_t> sortedId;
+    std::vector<float> sortedX, sortedY;
+};
@@ -0,0 +1,51 @@
+#include "sprite_renderer.h"
+
+void SpriteRenderer::init(RenderBackend* target) {
+    backend = target;
+    instances.reserve((MAX_BLOCKS + 1) + (MAX_POWERUPS + 1) * 3);
+}
+
+void SpriteRenderer::addBlock(int shape, int movementPattern, const Color& color, float x, float y) {
+    // Zor hareket desenlerinde rengi biraz parlat => // Brighten colour slightly for harder movement patterns
+    if (shape < SPRITE_SQUARE || shape > SPRITE_CIRCLE) {
+        return;
+    }
+    float brightness = movementPattern > 0 ? 1.0f + movementPattern * 0.2f : 1.0f;
+    add({ x, y, 0.1f, 0.1f, color.r, color.g, color.b, 1.0f, (float)shape, brightness });
+}
+
+void SpriteRenderer::addPowerUp(int type, float x, float y) {
+    float r = 0.0f, g = 0.0f, b = 0.0f;
+    switch (type) {
+        case 1: g = 1.0f; break;                    // Speed - Green
+        case 2: b = 1.0f; break;                    // Block reset - Blue
+        case 3: r = 1.0f; g = 1.0f; break;          // Invisibility - Yellow
+        case 4: g = 1.0f; b = 1.0f; break;          // Time slow - Cyan
+        case 5: r = 1.0f; b = 1.0f; break;          // Shield - Magenta
+        case 6: r = 1.0f; g = 0.2f; b = 0.8f; break; // Extra life - Pink/Purple
+    }
+
+    // Extra Life için arka plan hale => // Background halo for Extra Life
+    if (type == 6) {
+        const float size = 0.12f;
+        const float margin = (size - 0.08f) / 2;
+        add({ x - margin, y + margin, size, size, r, g, b, 0.3f, (float)SPRITE_SQUARE, 1.0f });
+    }
+
+    add({ x, y, 0.08f, 0.08f, r, g, b, 1.0f, (float)SPRITE_SQUARE, 1.0f });
+
+    // Extra Life için kalp sembolü => // Heart symbol for Extra Life
+    if (type == 6) {
+        const float size = 0.03f;
+        float centerX = x + 0.04f;
+        float centerY = y - 0.04f;
+        add({ centerX - size, centerY + size / 2, size * 2, size * 2, 1.0f, 0.0f, 0.0f, 1.0f, (float)SPRITE_HEART, 1.0f });
+    }
+}
+
+void SpriteRenderer::flush() {
+    if (instances.empty() || !isAvailable()) {
+        return;
+    }
+    backend->sprites(instances.data(), instances.size());
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+// Örneklemeli (instanced) sprite çizici: tüm bloklar ve power-up'lar örnek başına
+// veriyle (konum, şekil, renk, parlaklık) tek bir çizim çağrısında çizilir. Şekiller
+// (kare, üçgen, daire, kalp) fragment shader'da birim kareden oyulur, bu yüzden
+// çizim çağrısı sayısı varlık sayısından bağımsızdır.
+// Instanced sprite renderer: all blocks and power-ups are drawn in one draw call
+// from per-instance data (position, shape, colour, brightness). Shapes (square,
+// triangle, circle, heart) are carved out of a unit quad in the fragment shader,
+// so the draw-call count does not depend on the entity count.
+
+#include <vector>
+#include "game_simulation.h"
+#include "render_backend.h"
+
+class SpriteRenderer {
+public:
+    // Örnekler bu arka uçla çizilir => // Instances are drawn through this backend
+    void init(RenderBackend* target);
+    // Arka uç örneklemeyi desteklemiyorsa şekiller tek tek çizilmeli
+    // When the backend does not support instancing the shapes must be drawn one by one
+    bool isAvailable() const { return backend && backend->supportsSprites(); }
+
+    void begin() { instances.clear(); }
+    void add(const SpriteInstance& instance) { instances.push_back(instance); }
+    // drawBlock / drawPowerUp ile aynı geometri => // Same geometry as drawBlock / drawPowerUp
+    void addBlock(int shape, int movementPattern, const Color& color, float x, float y);
+    void addPowerUp(int type, float x, float y);
+    // Toplanan tüm örnekleri tek çağrıda çiz => // Draw every collected instance in one call
+    void flush();
+
+private:
+    std::vector<SpriteInstance> instances;
+    RenderBackend* backend = nullptr;
+};
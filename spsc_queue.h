@@ -0,0 +1,48 @@
+#pragma once
+
+// Kilitsiz tek üretici / tek tüketici halka kuyruğu.
+// Lock-free single-producer / single-consumer ring queue.
+//
+// push() yalnızca bir iş parçacığından, pop() yalnızca bir başkasından çağrılır;
+// ikisi de asla beklemez. Kuyruk doluysa push() false döner ve öğe düşer.
+// push() is called from one thread only and pop() from one other thread; neither
+// ever blocks. When the queue is full push() returns false and the item is dropped.
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "queue capacity must be a power of two");
+
+public:
+    // Üretici => // Producer
+    bool push(const T& value) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) >= Capacity) {
+            return false;
+        }
+        items[tail & (Capacity - 1)] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Tüketici => // Consumer
+    bool pop(T& value) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = items[head & (Capacity - 1)];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    std::array<T, Capacity> items;
+    // Ayrı önbellek satırları; üretici ve tüketici birbirinin satırını geçersiz kılmaz
+    // Separate cache lines so producer and consumer do not invalidate each other's line
+    alignas(64) std::atomic<size_t> head_{0}; // pop() yazar => // written by pop()
+    alignas(64) std::atomic<size_t> tail_{0}; // push() yazar => // written by push()
+};
@@ -0,0 +1,46 @@
+#include "text_layout.h"
+#include "font_atlas.h"
+#include <algorithm>
+
+size_t layoutText(const std::string& text, float scale, std::vector<TextVertex>& out) {
+    size_t start = out.size();
+    float currentX = 0.0f;
+    float currentY = 0.0f;
+
+    for (char c : text) {
+        if (c == '\n') {
+            currentY -= FONT_LINE_HEIGHT * scale;
+            currentX = 0.0f;
+            continue;
+        }
+
+        const FontGlyph& ch = fontGlyph(c);
+        if (ch.visible) {
+            float x0 = currentX;
+            float x1 = currentX + ch.width * scale;
+            float y0 = currentY - ch.height * scale;
+            float y1 = currentY;
+            out.push_back({ x0, y0, ch.u0, ch.v1 });
+            out.push_back({ x1, y0, ch.u1, ch.v1 });
+            out.push_back({ x1, y1, ch.u1, ch.v0 });
+            out.push_back({ x0, y1, ch.u0, ch.v0 });
+        }
+        currentX += ch.advance * scale;
+    }
+
+    return out.size() - start;
+}
+
+float measureText(const std::string& text, float scale) {
+    float widest = 0.0f;
+    float currentX = 0.0f;
+    for (char c : text) {
+        if (c == '\n') {
+            widest = std::max(widest, currentX);
+            currentX = 0.0f;
+            continue;
+        }
+        currentX += fontGlyph(c).advance * scale;
+    }
+    return std::max(widest, currentX);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+// Metin yerleşimi: bir dizeyi font atlasındaki glif dörtgenlerine çevirir.
+// Text layout: turns a string into glyph quads from the font atlas.
+//
+// Dörtgenler (0, 0) başlangıç noktasına göre üretilir; konum çizimde öteleme
+// ile verilir, bu yüzden aynı (dize, ölçek) çifti her yerde yeniden kullanılır.
+// GL bağımlılığı yoktur (headless ve benchmark derlemelerinde de kullanılabilir).
+// Quads are produced relative to the (0, 0) origin; the position is applied as
+// a translation at draw time, so the same (string, scale) pair can be reused
+// anywhere. No GL dependency (usable from headless and benchmark builds).
+
+#include <string>
+#include <vector>
+
+struct TextVertex {
+    float x, y;
+    float u, v;
+};
+
+// Görünen her glif için 4 köşe (GL_QUADS sırası) ekler; eklenen köşe sayısını döner
+// Appends 4 vertices (GL_QUADS order) per visible glyph; returns how many were appended
+size_t layoutText(const std::string& text, float scale, std::vector<TextVertex>& out);
+
+// Metnin en geniş satırının genişliği (ortalamak için) => // Width of the widest line (for centring)
+float measureText(const std::string& text, float scale);
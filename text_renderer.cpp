@@ -0,0 +1,71 @@
+#include "text_renderer.h"
+#include "font_atlas.h"
+#include <cstddef>
+
+bool TextRenderer::init(RenderBackend* target) {
+    backend = target;
+    fontLoaded = backend->loadFont(FONT_ATLAS.data(), FONT_ATLAS_WIDTH, FONT_ATLAS_HEIGHT);
+    if (!fontLoaded) {
+        return false;
+    }
+    meshes.reserve(MAX_CACHED);
+    return true;
+}
+
+TextRenderer::TextMesh& TextRenderer::findOrBuild(const std::string& text, float scale) {
+    useCounter++;
+
+    // Az sayıda etiket var; doğrusal arama anahtar kopyalamadan daha ucuz
+    // There are few labels; a linear scan is cheaper than building a key
+    for (TextMesh& mesh : meshes) {
+        if (mesh.scale == scale && mesh.text == text) {
+            mesh.lastUsed = useCounter;
+            return mesh;
+        }
+    }
+
+    TextMesh* target;
+    if (meshes.size() < MAX_CACHED) {
+        meshes.emplace_back();
+        target = &meshes.back();
+        target->mesh = backend->createMesh();
+    } else {
+        // En uzun süre kullanılmayanı yeniden kullan => // Reuse the least recently used one
+        target = &meshes[0];
+        for (TextMesh& mesh : meshes) {
+            if (mesh.lastUsed < target->lastUsed) {
+                target = &mesh;
+            }
+        }
+    }
+
+    scratch.clear();
+    layoutText(text, scale, scratch);
+
+    target->text = text;
+    target->scale = scale;
+    target->vertexCount = scratch.size();
+    target->lastUsed = useCounter;
+
+    backend->updateMesh(target->mesh, scratch.data(), scratch.size());
+    return *target;
+}
+
+void TextRenderer::draw(const std::string& text, float x, float y, float scale, float r, float g, float b) {
+    if (!fontLoaded) {
+        return;
+    }
+
+    const TextMesh& mesh = findOrBuild(text, scale);
+    backend->drawText(mesh.mesh, mesh.vertexCount, x, y, r, g, b);
+}
+
+void TextRenderer::release() {
+    for (TextMesh& mesh : meshes) {
+        if (mesh.mesh != 0) {
+            backend->destroyMesh(mesh.mesh);
+        }
+    }
+    meshes.clear();
+    fontLoaded = false;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+// Önbellekli metin çizici: her (dize, ölçek) çifti için yerleşim bir kez yapılır
+// ve hazır bir vertex buffer'da tutulur; sonraki karelerde etiket tek bir çizim
+// çağrısıyla, karakter başına CPU işi olmadan çizilir.
+// Cached text renderer: each (string, scale) pair is laid out once and kept in
+// a ready vertex buffer; later frames draw the label with one draw call and no
+// per-character CPU work.
+//
+// Önbellek sabit boyutludur; dolduğunda en uzun süre kullanılmayan girdinin
+// buffer'ı yeni metin için yeniden kullanılır (ör. değişen skor etiketi).
+// The cache has a fixed size; when full, the least recently used entry's buffer
+// is reused for the new text (e.g. a changing score label).
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "render_backend.h"
+#include "text_layout.h"
+
+class TextRenderer {
+public:
+    // Font atlasını arka uca yükle; başarısız olursa false döner
+    // Upload the font atlas to the backend; returns false on failure
+    bool init(RenderBackend* target);
+    bool isAvailable() const { return fontLoaded; }
+    // Önbellekteki ağları sil (arka uç serbest bırakılmadan önce) => // Delete the cached meshes (before the backend is released)
+    void release();
+
+    // (x, y) metnin sol üst köşesi => // (x, y) is the top-left corner of the text
+    void draw(const std::string& text, float x, float y, float scale, float r, float g, float b);
+
+    size_t cachedCount() const { return meshes.size(); }
+
+private:
+    struct TextMesh {
+        std::string text;
+        float scale = 0.0f;
+        uint32_t mesh = 0;
+        size_t vertexCount = 0;
+        uint64_t lastUsed = 0;
+    };
+
+    TextMesh& findOrBuild(const std::string& text, float scale);
+
+    static const size_t MAX_CACHED = 64;
+
+    std::vector<TextMesh> meshes;
+    std::vector<TextVertex> scratch; // Yerleşim için yeniden kullanılır
+    RenderBackend* backend = nullptr;
+    bool fontLoaded = false;
+    uint64_t useCounter = 0;
+};
@@ -0,0 +1,153 @@
+#include "timer_wheel.h"
+
+TimerWheel::TimerWheel() {
+    for (auto& level : slotHeads) {
+        level.fill(NO_NODE);
+    }
+}
+
+void TimerWheel::reserve(size_t timers) {
+    nodes.reserve(timers);
+    freeNodes.reserve(timers);
+}
+
+uint32_t TimerWheel::lookup(TimerId id) const {
+    uint32_t index = (uint32_t)id;
+    if (index >= nodes.size() || !nodes[index].active || nodes[index].generation != (uint32_t)(id >> 32)) {
+        return NO_NODE;
+    }
+    return index;
+}
+
+// Kalan süreye göre seviye ve yuva seç => // Pick the level and slot from the remaining time
+void TimerWheel::insert(uint32_t index) {
+    Node& node = nodes[index];
+    const uint64_t delta = node.deadline > now ? node.deadline - now : 0;
+
+    int level = 0;
+    while (level < LEVELS - 1 && delta >= (1ULL << (SLOT_BITS * (level + 1)))) {
+        level++;
+    }
+    uint64_t slot;
+    if (delta >= (1ULL << (SLOT_BITS * LEVELS))) {
+        // Çarkın menzili dışında: en son dağıtılacak üst yuvaya koy, dağıtılınca yeniden yerleşir
+        // Beyond the wheel's range: park it in the last top slot to cascade, it is re-placed then
+        slot = (now >> (SLOT_BITS * level)) + SLOTS - 1;
+    } else {
+        slot = node.deadline >> (SLOT_BITS * level);
+    }
+    slot &= SLOTS - 1;
+
+    node.level = (uint8_t)level;
+    node.slot = (uint8_t)slot;
+    node.prev = NO_NODE;
+    node.next = slotHeads[level][slot];
+    if (node.next != NO_NODE) {
+        nodes[node.next].prev = index;
+    }
+    slotHeads[level][slot] = index;
+}
+
+void TimerWheel::unlink(uint32_t index) {
+    Node& node = nodes[index];
+    if (node.prev != NO_NODE) {
+        nodes[node.prev].next = node.next;
+    } else {
+        slotHeads[node.level][node.slot] = node.next;
+    }
+    if (node.next != NO_NODE) {
+        nodes[node.next].prev = node.prev;
+    }
+}
+
+void TimerWheel::release(uint32_t index) {
+    nodes[index].active = false;
+    nodes[index].generation++;
+    freeNodes.push_back(index);
+    activeCount--;
+}
+
+// Alt seviye başa döndüyse üstteki yuvayı aşağı dağıt; önce en üst seviye
+// If a lower level wrapped, spread the slot above it down; top level first
+void TimerWheel::cascade() {
+    if ((now & (SLOTS - 1)) != 0) {
+        return;
+    }
+    int top = 1;
+    while (top < LEVELS - 1 && ((now >> (SLOT_BITS * top)) & (SLOTS - 1)) == 0) {
+        top++;
+    }
+    for (int level = top; level >= 1; level--) {
+        uint32_t slot = (uint32_t)((now >> (SLOT_BITS * level)) & (SLOTS - 1));
+        uint32_t index = slotHeads[level][slot];
+        slotHeads[level][slot] = NO_NODE;
+        while (index != NO_NODE) {
+            uint32_t next = nodes[index].next;
+            insert(index);
+            index = next;
+        }
+    }
+}
+
+TimerId TimerWheel::schedule(uint64_t delay, uint64_t payload) {
+    uint32_t index;
+    if (!freeNodes.empty()) {
+        index = freeNodes.back();
+        freeNodes.pop_back();
+    } else {
+        index = (uint32_t)nodes.size();
+        nodes.push_back({});
+    }
+    Node& node = nodes[index];
+    node.deadline = now + (delay > 0 ? delay : 1);
+    node.payload = payload;
+    node.active = true;
+    insert(index);
+    activeCount++;
+    return ((TimerId)node.generation << 32) | index;
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    uint32_t index = lookup(id);
+    if (index == NO_NODE) {
+        return false;
+    }
+    unlink(index);
+    release(index);
+    return true;
+}
+
+bool TimerWheel::reschedule(TimerId id, uint64_t delay) {
+    uint32_t index = lookup(id);
+    if (index == NO_NODE) {
+        return false;
+    }
+    unlink(index);
+    nodes[index].deadline = now + (delay > 0 ? delay : 1);
+    insert(index);
+    return true;
+}
+
+bool TimerWheel::isActive(TimerId id) const {
+    return lookup(id) != NO_NODE;
+}
+
+uint64_t TimerWheel::remaining(TimerId id) const {
+    uint32_t index = lookup(id);
+    return index == NO_NODE ? 0 : nodes[index].deadline - now;
+}
+
+void TimerWheel::clear() {
+    for (auto& level : slotHeads) {
+        level.fill(NO_NODE);
+    }
+    freeNodes.clear();
+    for (uint32_t index = 0; index < (uint32_t)nodes.size(); index++) {
+        if (nodes[index].active) {
+            nodes[index].active = false;
+            nodes[index].generation++;
+        }
+        freeNodes.push_back(index);
+    }
+    activeCount = 0;
+}
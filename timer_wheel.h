@@ -0,0 +1,109 @@
+#pragma once
+
+// Hiyerarşik zamanlayıcı çarkı (hierarchical timer wheel).
+// Hierarchical timer wheel.
+//
+// Zaman tam sayı tiklerle ilerler. Dört seviyenin her birinde 64 yuva vardır;
+// 0. seviye önümüzdeki 64 tiki tek tek, üst seviyeler 64'er kat daha geniş
+// aralıkları tutar. Bir alt seviye başa döndüğünde üstteki yuva aşağı dağıtılır
+// (cascade). Her zamanlayıcı en fazla 3 kez taşınır, bu yüzden advance() maliyeti
+// etkin zamanlayıcı sayısına değil, o tikte dolanların sayısına bağlıdır.
+// Time advances in integer ticks. Each of the four levels has 64 slots; level 0
+// holds the next 64 ticks one by one and every level above covers 64 times
+// wider ranges. When a lower level wraps, the matching slot above is spread
+// down (cascade). A timer moves at most 3 times, so the cost of advance()
+// depends on how many timers expire, not on how many are active.
+//
+// Ekleme, iptal ve yeniden kurma O(1)'dir (düğüm havuzunda çift bağlı listeler).
+// Aynı tikte dolan zamanlayıcılar belirli bir sırayla çağrılır; simülasyon
+// deterministik kalır.
+// Schedule, cancel and reschedule are O(1) (doubly linked lists in a node
+// pool). Timers expiring on the same tick are visited in a fixed order, so the
+// simulation stays deterministic.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Düşük 32 bit düğüm indeksi, yüksek 32 bit nesil; eski kimlikler güvenle reddedilir
+// Low 32 bits are the node index, high 32 bits the generation; stale ids are safely rejected
+using TimerId = uint64_t;
+const TimerId INVALID_TIMER = ~0ULL;
+
+class TimerWheel {
+public:
+    static const int LEVELS = 4;
+    static const int SLOT_BITS = 6;
+    static const uint32_t SLOTS = 1u << SLOT_BITS;
+
+    TimerWheel();
+
+    // Havuzu önceden ayır => // Allocate the node pool up front
+    void reserve(size_t timers);
+
+    // delay tik sonra (en az 1) dolacak zamanlayıcı kur => // Schedule a timer that expires delay ticks from now (at least 1)
+    TimerId schedule(uint64_t delay, uint64_t payload);
+    // Dolmadan kaldır; zamanlayıcı zaten yoksa false => // Remove before it expires; false if it is already gone
+    bool cancel(TimerId id);
+    // Şimdiden delay tik sonraya taşı => // Move it to delay ticks from now
+    bool reschedule(TimerId id, uint64_t delay);
+
+    bool isActive(TimerId id) const;
+    // Dolmasına kalan tik; yoksa 0 => // Ticks until it expires; 0 if it is gone
+    uint64_t remaining(TimerId id) const;
+
+    // Bir tik ilerle ve dolan her zamanlayıcı için expire(payload) çağır.
+    // Geri çağrı yeni zamanlayıcı kurabilir veya iptal edebilir.
+    // Advance one tick and call expire(payload) for every timer that expires.
+    // The callback may schedule or cancel timers.
+    template <typename Expire>
+    void advance(Expire&& expire) {
+        now++;
+        cascade();
+        // Baştan birer birer çıkar: geri çağrı aynı yuvadaki başka zamanlayıcıyı iptal edebilir,
+        // bu yuvaya yenisini ekleyemez (gecikme >= 1)
+        // Pop from the front one at a time: a callback may cancel another timer in this
+        // slot but cannot add to it (delay >= 1)
+        uint32_t& head = slotHeads[0][now & (SLOTS - 1)];
+        while (head != NO_NODE) {
+            uint32_t node = head;
+            uint64_t payload = nodes[node].payload;
+            unlink(node);
+            release(node);
+            expire(payload);
+        }
+    }
+
+    // Tüm zamanlayıcıları geri çağrısız sil; zaman sıfırlanmaz => // Drop every timer without callbacks; time is not reset
+    void clear();
+
+    uint64_t currentTick() const { return now; }
+    size_t size() const { return activeCount; }
+
+private:
+    static const uint32_t NO_NODE = ~0u;
+
+    struct Node {
+        uint64_t deadline;
+        uint64_t payload;
+        uint32_t prev;
+        uint32_t next;
+        uint32_t generation;
+        uint8_t level;
+        uint8_t slot;
+        bool active;
+    };
+
+    void insert(uint32_t node);
+    void unlink(uint32_t node);
+    void release(uint32_t node);
+    void cascade();
+    uint32_t lookup(TimerId id) const;
+
+    std::vector<Node> nodes;
+    std::vector<uint32_t> freeNodes;
+    std::array<std::array<uint32_t, SLOTS>, LEVELS> slotHeads;
+    uint64_t now = 0;
+    size_t activeCount = 0;
+};
@@ -0,0 +1,163 @@
+#include "trig_tables.h"
+#include <cmath>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// Cephes sinf/cosf: açı pi/2 katlarına indirgenir, [-pi/4, pi/4] aralığında polinom
+// Cephes sinf/cosf: reduce by multiples of pi/2, then a polynomial on [-pi/4, pi/4]
+static const float TWO_OVER_PI = 0.636619772367581343f;
+static const float DP1 = 1.5703125f;              // pi/2 = DP1 + DP2 + DP3 (Cody-Waite)
+static const float DP2 = 4.837512969970703125e-4f;
+static const float DP3 = 7.54978995489188216e-8f;
+static const float S1 = -1.6666654611e-1f;
+static const float S2 = 8.3321608736e-3f;
+static const float S3 = -1.9515295891e-4f;
+static const float C1 = 4.166664568298827e-2f;
+static const float C2 = -1.388731625493765e-3f;
+static const float C3 = 2.443315711809948e-5f;
+
+// Tek açı için referans; SIMD yolları aynı adımları izler
+// Reference for one angle; the SIMD paths follow the same steps
+static inline void sinCosOne(float angle, float& s, float& c) {
+    int j = (int)std::nearbyint(angle * TWO_OVER_PI);
+    float fj = (float)j;
+    float y = ((angle - fj * DP1) - fj * DP2) - fj * DP3;
+    float z = y * y;
+
+    float sinP = y + y * z * (S1 + z * (S2 + z * S3));
+    float cosP = 1.0f - 0.5f * z + z * z * (C1 + z * (C2 + z * C3));
+
+    // Çeyreğe göre yer değiştir ve işaret ver => // Swap and sign by quadrant
+    bool swap = (j & 1) != 0;
+    s = swap ? cosP : sinP;
+    c = swap ? sinP : cosP;
+    if (j & 2) s = -s;
+    if ((j + 1) & 2) c = -c;
+}
+
+void sinCosBatchScalar(const float* angles, float* sines, float* cosines, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        sinCosOne(angles[i], sines[i], cosines[i]);
+    }
+}
+
+void sinCosBatch(const float* angles, float* sines, float* cosines, size_t n) {
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256 twoOverPi = _mm256_set1_ps(TWO_OVER_PI);
+    const __m256 dp1 = _mm256_set1_ps(DP1), dp2 = _mm256_set1_ps(DP2), dp3 = _mm256_set1_ps(DP3);
+    const __m256 s1 = _mm256_set1_ps(S1), s2 = _mm256_set1_ps(S2), s3 = _mm256_set1_ps(S3);
+    const __m256 c1 = _mm256_set1_ps(C1), c2 = _mm256_set1_ps(C2), c3 = _mm256_set1_ps(C3);
+    const __m256 half = _mm256_set1_ps(0.5f), one = _mm256_set1_ps(1.0f);
+    const __m256i oneI = _mm256_set1_epi32(1), twoI = _mm256_set1_epi32(2);
+
+    for (; i + 8 <= n; i += 8) {
+        __m256 angle = _mm256_loadu_ps(angles + i);
+        __m256i j = _mm256_cvtps_epi32(_mm256_mul_ps(angle, twoOverPi));
+        __m256 fj = _mm256_cvtepi32_ps(j);
+        __m256 y = _mm256_sub_ps(angle, _mm256_mul_ps(fj, dp1));
+        y = _mm256_sub_ps(y, _mm256_mul_ps(fj, dp2));
+        y = _mm256_sub_ps(y, _mm256_mul_ps(fj, dp3));
+        __m256 z = _mm256_mul_ps(y, y);
+
+        __m256 sinP = _mm256_add_ps(s2, _mm256_mul_ps(z, s3));
+        sinP = _mm256_add_ps(s1, _mm256_mul_ps(z, sinP));
+        sinP = _mm256_add_ps(y, _mm256_mul_ps(_mm256_mul_ps(y, z), sinP));
+        __m256 cosP = _mm256_add_ps(c2, _mm256_mul_ps(z, c3));
+        cosP = _mm256_add_ps(c1, _mm256_mul_ps(z, cosP));
+        cosP = _mm256_add_ps(_mm256_sub_ps(one, _mm256_mul_ps(half, z)),
+                             _mm256_mul_ps(_mm256_mul_ps(z, z), cosP));
+
+        __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, oneI), oneI));
+        __m256 s = _mm256_blendv_ps(sinP, cosP, swap);
+        __m256 c = _mm256_blendv_ps(cosP, sinP, swap);
+        __m256 sSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, twoI), 30));
+        __m256 cSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(j, oneI), twoI), 30));
+        _mm256_storeu_ps(sines + i, _mm256_xor_ps(s, sSign));
+        _mm256_storeu_ps(cosines + i, _mm256_xor_ps(c, cSign));
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128 twoOverPi = _mm_set1_ps(TWO_OVER_PI);
+    const __m128 dp1 = _mm_set1_ps(DP1), dp2 = _mm_set1_ps(DP2), dp3 = _mm_set1_ps(DP3);
+    const __m128 s1 = _mm_set1_ps(S1), s2 = _mm_set1_ps(S2), s3 = _mm_set1_ps(S3);
+    const __m128 c1 = _mm_set1_ps(C1), c2 = _mm_set1_ps(C2), c3 = _mm_set1_ps(C3);
+    const __m128 half = _mm_set1_ps(0.5f), one = _mm_set1_ps(1.0f);
+    const __m128i oneI = _mm_set1_epi32(1), twoI = _mm_set1_epi32(2);
+
+    for (; i + 4 <= n; i += 4) {
+        __m128 angle = _mm_loadu_ps(angles + i);
+        __m128i j = _mm_cvtps_epi32(_mm_mul_ps(angle, twoOverPi));
+        __m128 fj = _mm_cvtepi32_ps(j);
+        __m128 y = _mm_sub_ps(angle, _mm_mul_ps(fj, dp1));
+        y = _mm_sub_ps(y, _mm_mul_ps(fj, dp2));
+        y = _mm_sub_ps(y, _mm_mul_ps(fj, dp3));
+        __m128 z = _mm_mul_ps(y, y);
+
+        __m128 sinP = _mm_add_ps(s2, _mm_mul_ps(z, s3));
+        sinP = _mm_add_ps(s1, _mm_mul_ps(z, sinP));
+        sinP = _mm_add_ps(y, _mm_mul_ps(_mm_mul_ps(y, z), sinP));
+        __m128 cosP = _mm_add_ps(c2, _mm_mul_ps(z, c3));
+        cosP = _mm_add_ps(c1, _mm_mul_ps(z, cosP));
+        cosP = _mm_add_ps(_mm_sub_ps(one, _mm_mul_ps(half, z)), _mm_mul_ps(_mm_mul_ps(z, z), cosP));
+
+        // SSE2'de blendv yok; and/andnot ile seç => // No blendv in SSE2; select with and/andnot
+        __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, oneI), oneI));
+        __m128 s = _mm_or_ps(_mm_and_ps(swap, cosP), _mm_andnot_ps(swap, sinP));
+        __m128 c = _mm_or_ps(_mm_and_ps(swap, sinP), _mm_andnot_ps(swap, cosP));
+        __m128 sSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, twoI), 30));
+        __m128 cSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(j, oneI), twoI), 30));
+        _mm_storeu_ps(sines + i, _mm_xor_ps(s, sSign));
+        _mm_storeu_ps(cosines + i, _mm_xor_ps(c, cSign));
+    }
+#elif defined(__ARM_NEON)
+    const float32x4_t twoOverPi = vdupq_n_f32(TWO_OVER_PI);
+    const float32x4_t dp1 = vdupq_n_f32(DP1), dp2 = vdupq_n_f32(DP2), dp3 = vdupq_n_f32(DP3);
+    const float32x4_t s1 = vdupq_n_f32(S1), s2 = vdupq_n_f32(S2), s3 = vdupq_n_f32(S3);
+    const float32x4_t c1 = vdupq_n_f32(C1), c2 = vdupq_n_f32(C2), c3 = vdupq_n_f32(C3);
+    const float32x4_t half = vdupq_n_f32(0.5f), one = vdupq_n_f32(1.0f);
+    const int32x4_t oneI = vdupq_n_s32(1), twoI = vdupq_n_s32(2);
+
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t angle = vld1q_f32(angles + i);
+        // vcvtq kesirli kısmı atar; en yakına yuvarlamak için işaretli 0.5 ekle
+        // vcvtq truncates; add a signed 0.5 to round to nearest
+        float32x4_t q = vmulq_f32(angle, twoOverPi);
+        uint32x4_t negative = vcltq_f32(q, vdupq_n_f32(0.0f));
+        q = vaddq_f32(q, vbslq_f32(negative, vdupq_n_f32(-0.5f), half));
+        int32x4_t j = vcvtq_s32_f32(q);
+        float32x4_t fj = vcvtq_f32_s32(j);
+        float32x4_t y = vsubq_f32(angle, vmulq_f32(fj, dp1));
+        y = vsubq_f32(y, vmulq_f32(fj, dp2));
+        y = vsubq_f32(y, vmulq_f32(fj, dp3));
+        float32x4_t z = vmulq_f32(y, y);
+
+        float32x4_t sinP = vaddq_f32(s2, vmulq_f32(z, s3));
+        sinP = vaddq_f32(s1, vmulq_f32(z, sinP));
+        sinP = vaddq_f32(y, vmulq_f32(vmulq_f32(y, z), sinP));
+        float32x4_t cosP = vaddq_f32(c2, vmulq_f32(z, c3));
+        cosP = vaddq_f32(c1, vmulq_f32(z, cosP));
+        cosP = vaddq_f32(vsubq_f32(one, vmulq_f32(half, z)), vmulq_f32(vmulq_f32(z, z), cosP));
+
+        uint32x4_t swap = vceqq_s32(vandq_s32(j, oneI), oneI);
+        float32x4_t s = vbslq_f32(swap, cosP, sinP);
+        float32x4_t c = vbslq_f32(swap, sinP, cosP);
+        uint32x4_t sSign = vreinterpretq_u32_s32(vshlq_n_s32(vandq_s32(j, twoI), 30));
+        uint32x4_t cSign = vreinterpretq_u32_s32(vshlq_n_s32(vandq_s32(vaddq_s32(j, oneI), twoI), 30));
+        vst1q_f32(sines + i, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(s), sSign)));
+        vst1q_f32(cosines + i, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(c), cSign)));
+    }
+#endif
+
+    // Kalan açılar => // Remaining angles
+    for (; i < n; i++) {
+        sinCosOne(angles[i], sines[i], cosines[i]);
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+// Derleme zamanında üretilen trigonometri tabloları ve vektörel sincos.
+// Compile-time trig tables and a vectorized sincos.
+//
+// Efekt üreticileri ve şekil çizicileri hep aynı sabit açıları kullanır (tam
+// dereceler, N parçalı daireler); bunlar constexpr tablolardan okunur, çalışma
+// zamanında cos/sin çağrılmaz. Rastgele açılar için (ör. parçacık dönüşü)
+// sinCosBatch aynı anda 4-8 açı işler.
+// Effect spawners and shape tessellators always use the same fixed angles
+// (whole degrees, N-segment circles); those are read from constexpr tables and
+// no cos/sin is called at run time. For arbitrary angles (e.g. particle
+// rotation) sinCosBatch handles 4-8 angles at a time.
+
+#include <array>
+#include <cstddef>
+
+struct SinCos {
+    float s, c;
+};
+
+constexpr double TRIG_PI = 3.14159265358979323846;
+constexpr double TRIG_TWO_PI = 2.0 * TRIG_PI;
+
+// Açıyı [-π, π] aralığına sar => // Wrap the angle to [-π, π]
+constexpr double constexprWrapPi(double x) {
+    while (x > TRIG_PI) x -= TRIG_TWO_PI;
+    while (x < -TRIG_PI) x += TRIG_TWO_PI;
+    return x;
+}
+
+// constexpr Taylor serisi; yalnızca tablo üretimi için => // constexpr Taylor series, for table generation only
+constexpr double constexprSin(double x) {
+    x = constexprWrapPi(x);
+    double term = x, sum = x;
+    for (int n = 1; n < 20; n++) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double constexprCos(double x) {
+    x = constexprWrapPi(x);
+    double term = 1.0, sum = 1.0;
+    for (int n = 1; n < 20; n++) {
+        term *= -x * x / ((2 * n - 1) * (2 * n));
+        sum += term;
+    }
+    return sum;
+}
+
+// [0, arc] aralığını N parçaya bölen N+1 nokta => // N+1 points splitting [0, arc] into N segments
+template <size_t N>
+constexpr std::array<SinCos, N + 1> makeArcTable(double arc) {
+    std::array<SinCos, N + 1> table{};
+    for (size_t i = 0; i <= N; i++) {
+        double angle = arc * (double)i / (double)N;
+        table[i] = { (float)constexprSin(angle), (float)constexprCos(angle) };
+    }
+    return table;
+}
+
+constexpr std::array<SinCos, 360> makeDegreeTable() {
+    std::array<SinCos, 360> table{};
+    for (size_t i = 0; i < 360; i++) {
+        double angle = (double)i * TRIG_PI / 180.0;
+        table[i] = { (float)constexprSin(angle), (float)constexprCos(angle) };
+    }
+    return table;
+}
+
+// Tam derece başına sin/cos => // sin/cos per whole degree
+inline constexpr std::array<SinCos, 360> DEGREE_TABLE = makeDegreeTable();
+
+// Tam daire (son nokta ilk noktaya eşit) ve yarım daire; üçgen yelpazeleri için
+// Full circle (last point equals the first) and half circle, for triangle fans
+template <size_t N>
+inline constexpr std::array<SinCos, N + 1> UNIT_CIRCLE = makeArcTable<N>(TRIG_TWO_PI);
+template <size_t N>
+inline constexpr std::array<SinCos, N + 1> HALF_CIRCLE = makeArcTable<N>(TRIG_PI);
+
+static_assert(DEGREE_TABLE[90].s > 0.9999999f && DEGREE_TABLE[180].c < -0.9999999f,
+              "constexpr trig table is inaccurate");
+
+// Herhangi bir tam derece (negatif ya da 360'tan büyük olabilir) => // Any whole degree (may be negative or >= 360)
+inline const SinCos& sinCosDegrees(int degrees) {
+    int wrapped = degrees % 360;
+    return DEGREE_TABLE[wrapped < 0 ? wrapped + 360 : wrapped];
+}
+
+// n açının (radyan) sin/cos değerlerini hesapla; SIMD yolu ile skaler yol aynı polinomu kullanır
+// Compute sin/cos of n angles (radians); the SIMD and scalar paths share the same polynomial
+void sinCosBatch(const float* angles, float* sines, float* cosines, size_t n);
+// Referans skaler yol; SIMD sonuçlarını doğrulamak için => // Reference scalar path, for checking the SIMD results
+void sinCosBatchScalar(const float* angles, float* sines, float* cosines, size_t n);
@@ -0,0 +1,57 @@
+#pragma once
+
+// Kilitsiz üçlü tampon: bir yazar en son değeri yayınlar, bir okuyucu her zaman
+// en yenisini alır. Üç yuva vardır: yazarın arka yuvası, okuyucunun ön yuvası ve
+// aralarında el değiştiren orta yuva. Yayınlama ve alma tek bir atomik değiş
+// tokuştur; hiçbir taraf diğerini beklemez ve okuyucu yavaşsa ara değerler atlanır.
+// Lock-free triple buffer: one writer publishes the latest value and one reader
+// always gets the newest. There are three slots: the writer's back slot, the
+// reader's front slot and the middle slot handed between them. Publishing and
+// acquiring are a single atomic exchange each; neither side waits for the other
+// and values in between are skipped when the reader is slow.
+
+#include <atomic>
+#include <cstdint>
+
+template <typename T>
+class TripleBuffer {
+public:
+    // Yazar: back() yuvasını doldur, sonra publish() => // Writer: fill back(), then publish()
+    T& back() { return slots[backIndex]; }
+
+    void publish() {
+        uint8_t previous = middle.exchange((uint8_t)(backIndex | FRESH), std::memory_order_acq_rel);
+        backIndex = previous & INDEX_MASK;
+    }
+
+    // Okuyucu: yeni bir değer yayınlandıysa onu al; yoksa bir öncekini tekrar döndür.
+    // Dönen referans bir sonraki acquire() çağrısına kadar geçerlidir.
+    // Reader: take the newly published value if there is one, otherwise return the
+    // previous one again. The reference stays valid until the next acquire().
+    const T& acquire() {
+        // FRESH bitini yalnızca okuyucu temizler; görüldüyse değiş tokuş onu yine bulur
+        // Only the reader clears FRESH, so once seen the exchange still finds it set
+        if (middle.load(std::memory_order_relaxed) & FRESH) {
+            uint8_t previous = middle.exchange(frontIndex, std::memory_order_acq_rel);
+            frontIndex = previous & INDEX_MASK;
+        }
+        return slots[frontIndex];
+    }
+
+    // Paylaşmadan önce her yuvayı hazırla (ör. bellek ayır) => // Prepare every slot before sharing (e.g. allocate)
+    template <typename Fn>
+    void forEachSlot(Fn&& fn) {
+        for (T& slot : slots) {
+            fn(slot);
+        }
+    }
+
+private:
+    static const uint8_t INDEX_MASK = 0x3;
+    static const uint8_t FRESH = 0x4;
+
+    T slots[3];
+    std::atomic<uint8_t> middle{1};
+    uint8_t backIndex = 0;  // Yalnızca yazar => // Writer only
+    uint8_t frontIndex = 2; // Yalnızca okuyucu => // Reader only
+};
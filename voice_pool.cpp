@@ -0,0 +1,123 @@
+#include "voice_pool.h"
+#include "asset_loader.h"
+
+static_assert((SOUND_QUEUE_CAPACITY & (SOUND_QUEUE_CAPACITY - 1)) == 0, "queue capacity must be a power of two");
+
+VoicePool::VoicePool(size_t voiceCount) {
+    // Tüm sesler baştan ayrılır; oyun sırasında ses nesnesi oluşturulmaz
+    // Every voice is allocated up front; no sound objects are created during play
+    voices.reserve(voiceCount);
+    for (size_t i = 0; i < voiceCount; i++) {
+        voices.emplace_back(silence);
+    }
+    states.resize(voiceCount);
+}
+
+int VoicePool::addClip(SoundClip& clip, int priority, int maxInstances) {
+    clips.push_back({ &clip, priority, maxInstances });
+    return (int)clips.size() - 1;
+}
+
+bool VoicePool::post(int clipId) {
+    size_t tail = queueTail.load(std::memory_order_relaxed);
+    if (tail - queueHead.load(std::memory_order_acquire) >= SOUND_QUEUE_CAPACITY) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    queue[tail & (SOUND_QUEUE_CAPACITY - 1)] = (int16_t)clipId;
+    queueTail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+void VoicePool::update() {
+    size_t head = queueHead.load(std::memory_order_relaxed);
+    size_t tail = queueTail.load(std::memory_order_acquire);
+    for (; head != tail; head++) {
+        int clipId = queue[head & (SOUND_QUEUE_CAPACITY - 1)];
+        if (clipId >= 0 && clipId < (int)clips.size()) {
+            start(clipId);
+        }
+    }
+    queueHead.store(head, std::memory_order_release);
+}
+
+bool VoicePool::isBusy(size_t voice) const {
+    return states[voice].clipId >= 0 && voices[voice].getStatus() != sf::Sound::Status::Stopped;
+}
+
+void VoicePool::start(int clipId) {
+    const ClipSlot& slot = clips[clipId];
+    if (!slot.clip->waitReady()) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Ses seçimi: klip sınırındaysa kendi en eski kopyası, değilse boş ses, o da yoksa
+    // en düşük öncelikli (eşitse en eski) ses
+    // Voice choice: the clip's own oldest copy if it is at its limit, else a free
+    // voice, else the lowest-priority (then oldest) voice
+    size_t free = voices.size();
+    size_t oldestSame = voices.size();
+    size_t victim = voices.size();
+    int sameCount = 0;
+    for (size_t i = 0; i < voices.size(); i++) {
+        if (!isBusy(i)) {
+            if (free == voices.size()) free = i;
+            continue;
+        }
+        const VoiceState& state = states[i];
+        if (state.clipId == clipId) {
+            sameCount++;
+            if (oldestSame == voices.size() || state.startOrder < states[oldestSame].startOrder) oldestSame = i;
+        }
+        if (victim == voices.size() || state.priority < states[victim].priority ||
+            (state.priority == states[victim].priority && state.startOrder < states[victim].startOrder)) {
+            victim = i;
+        }
+    }
+
+    size_t voice;
+    if (sameCount >= slot.maxInstances) {
+        voice = oldestSame;
+    } else if (free != voices.size()) {
+        voice = free;
+    } else if (states[victim].priority <= slot.priority) {
+        voice = victim;
+        stolen++;
+    } else {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    sf::Sound& sound = voices[voice];
+    sound.stop();
+    if (states[voice].clipId != clipId) {
+        sound.setBuffer(slot.clip->buffer());
+    }
+    sound.setVolume(volume);
+    sound.play();
+    states[voice].clipId = clipId;
+    states[voice].priority = slot.priority;
+    states[voice].startOrder = nextOrder++;
+}
+
+void VoicePool::setVolume(float value) {
+    volume = value;
+    for (sf::Sound& sound : voices) {
+        sound.setVolume(value);
+    }
+}
+
+void VoicePool::stopAll() {
+    for (sf::Sound& sound : voices) {
+        sound.stop();
+    }
+}
+
+size_t VoicePool::activeVoices() const {
+    size_t active = 0;
+    for (size_t i = 0; i < voices.size(); i++) {
+        if (isBusy(i)) active++;
+    }
+    return active;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+// Sabit sayıda önceden ayrılmış ses (voice) ile çok sesli efekt çalma.
+// Polyphonic effect playback on a fixed set of preallocated voices.
+//
+// Her efekt klibinin bir önceliği ve aynı anda çalabileceği örnek sayısı vardır.
+// Boş ses yoksa en düşük öncelikli (eşitse en eski) ses çalınır; yeni olay daha
+// düşük öncelikliyse düşürülür. Böylece çarpışma fırtınasında bile ses sayısı,
+// bellek ve ses CPU'su sabit kalır, oyun sonu gibi önemli sesler kesilmez.
+// Every effect clip has a priority and a limit on how many copies may play at
+// once. With no free voice the lowest-priority (then oldest) voice is stolen;
+// an event with lower priority than every playing voice is dropped. So even a
+// collision storm keeps the voice count, memory and audio CPU flat, and
+// important sounds such as game over are never cut.
+//
+// Oyun tarafı post() ile kilitsiz (tek üretici / tek tüketici) bir kuyruğa yazar
+// ve asla beklemez; update() kuyruğu boşaltıp sesleri atar.
+// Gameplay writes with post() into a lock-free (single producer / single
+// consumer) queue and never blocks; update() drains it and assigns voices.
+
+#include <SFML/Audio.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class SoundClip;
+
+const size_t DEFAULT_VOICE_COUNT = 8;
+const size_t SOUND_QUEUE_CAPACITY = 64; // 2'nin kuvveti olmalı => // must be a power of two
+
+class VoicePool {
+public:
+    explicit VoicePool(size_t voiceCount = DEFAULT_VOICE_COUNT);
+
+    VoicePool(const VoicePool&) = delete;
+    VoicePool& operator=(const VoicePool&) = delete;
+
+    // Klibi kaydet ve kimliğini döndür; klip havuzdan uzun yaşamalı
+    // Register a clip and return its id; the clip must outlive the pool
+    int addClip(SoundClip& clip, int priority, int maxInstances);
+
+    // Çalma isteğini kuyruğa ekle; asla beklemez, kuyruk doluysa false (olay düşer)
+    // Queue a play request; never blocks, false if the queue is full (the event is dropped)
+    bool post(int clipId);
+
+    // Kuyruğu boşalt ve seslere ata; klip ilk kullanımda hâlâ yükleniyorsa burada beklenir
+    // Drain the queue and assign voices; a clip still loading at first use is waited for here
+    void update();
+
+    void setVolume(float value);
+    void stopAll();
+
+    size_t voiceCount() const { return voices.size(); }
+    size_t activeVoices() const;
+    // İstatistikler => // Statistics
+    uint64_t stolenCount() const { return stolen; }
+    uint64_t droppedCount() const { return dropped; }
+
+private:
+    struct ClipSlot {
+        SoundClip* clip;
+        int priority;
+        int maxInstances;
+    };
+
+    struct VoiceState {
+        int clipId = -1;
+        int priority = 0;
+        uint64_t startOrder = 0; // Başlama sırası; eşit öncelikte en eski çalınır
+    };
+
+    void start(int clipId);
+    bool isBusy(size_t voice) const;
+
+    sf::SoundBuffer silence;     // Seslerin başlangıç arabelleği (SFML 3 boş ses oluşturmaz)
+    std::vector<sf::Sound> voices;
+    std::vector<VoiceState> states;
+    std::vector<ClipSlot> clips;
+
+    std::array<int16_t, SOUND_QUEUE_CAPACITY> queue;
+    std::atomic<size_t> queueHead{0}; // update() okur => // read by update()
+    std::atomic<size_t> queueTail{0}; // post() yazar => // written by post()
+
+    float volume = 100.0f;
+    uint64_t nextOrder = 0;
+    uint64_t stolen = 0;
+    std::atomic<uint64_t> dropped{0};
+};